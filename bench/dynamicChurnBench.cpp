@@ -0,0 +1,169 @@
+// Name : Long Duong
+// Date: 10/17/2026
+// Description: Times DynamicStatistics under a mixed insert, erase and median workload against a sorted vector,
+//              then checks the moments it kept up to date against a rebuild from the values. Returns 0 when the
+//              moments agree. Build from the repository root, e.g.
+//                  g++ -std=c++20 -O2 -pthread bench/dynamicChurnBench.cpp stats/*.cpp -o dynamicChurnBench
+//                  cl /std:c++20 /O2 /EHsc bench\dynamicChurnBench.cpp stats\*.cpp
+//              and run with an optional operation count, 1000000 by default.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+#include "../dynamicStatistics.h"
+
+using namespace std;
+
+namespace
+{
+    int failures = 0;
+
+    double secondsSince(chrono::steady_clock::time_point start)
+    {
+        return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    }
+
+    void checkClose(double actual, double expected, double tolerance, const char* what)
+    {
+        if (!(fabs(actual - expected) <= tolerance * max(1.0, fabs(expected))))
+        {
+            failures++;
+            printf("FAILED: %s is %.17g, a rebuild gives %.17g\n", what, actual, expected);
+        }
+    }
+
+    // The moments kept by insert and erase must match the ones rebuilt from the tree.
+    void checkMoments(const DynamicStatistics<long long>& churned, const char* scenario)
+    {
+        DynamicStatistics<long long> rebuilt = churned;
+        rebuilt.recomputeMoments();
+        printf("%s: variance %.10g, rebuilt %.10g\n", scenario, churned.getVariance(), rebuilt.getVariance());
+        checkClose(churned.getVariance(), rebuilt.getVariance(), 1e-9, "variance");
+        checkClose(churned.getSkewness().value(), rebuilt.getSkewness().value(), 1e-6, "skewness");
+        checkClose(churned.getKurtosis().value(), rebuilt.getKurtosis().value(), 1e-6, "kurtosis");
+    }
+
+    // Inserts, erases of a random live value and median queries in equal shares. live mirrors the values so the
+    // erases always hit.
+    template <typename Insert, typename Erase, typename Median>
+    double churn(size_t operations, vector<long long>& live, mt19937_64& random, long long (*draw)(mt19937_64&),
+                 Insert insert, Erase erase, Median median)
+    {
+        double medianSum = 0;
+        for (size_t operation = 0; operation < operations; operation++)
+        {
+            switch (random() % 3)
+            {
+                case 0:
+                {
+                    long long value = draw(random);
+                    insert(value);
+                    live.push_back(value);
+                    break;
+                }
+                case 1:
+                {
+                    size_t index = random() % live.size();
+                    erase(live[index]);
+                    live[index] = live.back();
+                    live.pop_back();
+                    break;
+                }
+                default:
+                    medianSum += median();
+            }
+        }
+        return medianSum;
+    }
+
+    long long drawUniform(mt19937_64& random)
+    {
+        return static_cast<long long>(random() >> 1);
+    }
+
+    // Mostly values near 1e9, with one in ten up to 1e15: erasing the large ones, and finally all of them, is what
+    // makes removal rounding outgrow the spread of what stays.
+    long long drawWide(mt19937_64& random)
+    {
+        if (random() % 10 == 0)
+            return static_cast<long long>(random() % 1000000000000000LL);
+        return 1000000000LL + static_cast<long long>(random() % 1000000);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    size_t operations = argc > 1 ? static_cast<size_t>(strtoull(argv[1], nullptr, 10)) : size_t(1000000);
+    const size_t initialSize = 1000000;
+    mt19937_64 random(11);
+
+    vector<long long> initial(initialSize);
+    for (auto& value : initial)
+        value = drawUniform(random);
+
+    DynamicStatistics<long long> tree;
+    auto start = chrono::steady_clock::now();
+    for (auto value : initial)
+        tree.insert(value);
+    printf("%zu inserts into the tree: %.2f s\n", initialSize, secondsSince(start));
+
+    vector<long long> live = initial;
+    start = chrono::steady_clock::now();
+    double treeMedians = churn(operations, live, random, drawUniform,
+                               [&](long long value) { tree.insert(value); },
+                               [&](long long value) { tree.erase(value); },
+                               [&]() { return tree.getMedian().value_or(0); });
+    double treeSeconds = secondsSince(start);
+    printf("tree:          %zu ops in %.2f s (%.0f ops/s)\n", operations, treeSeconds, operations / treeSeconds);
+    checkMoments(tree, "uniform churn");
+
+    // The sorted vector shifts O(n) values per update, so it only runs a tenth of the operations.
+    vector<long long> sorted = initial;
+    sort(sorted.begin(), sorted.end());
+    vector<long long> sortedLive = initial;
+    size_t vectorOperations = operations / 10;
+    start = chrono::steady_clock::now();
+    auto insertSorted = [&](long long value)
+    {
+        sorted.insert(upper_bound(sorted.begin(), sorted.end(), value), value);
+    };
+    auto eraseSorted = [&](long long value) { sorted.erase(lower_bound(sorted.begin(), sorted.end(), value)); };
+    auto sortedMedian = [&]()
+    {
+        size_t n = sorted.size();
+        return n % 2 == 1 ? static_cast<double>(sorted[n / 2])
+                          : (static_cast<double>(sorted[n / 2 - 1]) + sorted[n / 2]) / 2.0;
+    };
+    double vectorMedians = churn(vectorOperations, sortedLive, random, drawUniform, insertSorted, eraseSorted,
+                                 sortedMedian);
+    double vectorSeconds = secondsSince(start);
+    printf("sorted vector: %zu ops in %.2f s (%.0f ops/s)\n", vectorOperations, vectorSeconds,
+           vectorOperations / vectorSeconds);
+
+    DynamicStatistics<long long> wide;
+    vector<long long> wideLive;
+    for (int i = 0; i < 1000; i++)
+    {
+        long long value = 1000000000LL + static_cast<long long>(random() % 1000000);
+        wide.insert(value);
+        wideLive.push_back(value);
+    }
+    churn(operations, wideLive, random, drawWide,
+          [&](long long value) { wide.insert(value); },
+          [&](long long value) { wide.erase(value); },
+          [&]() { return wide.getMedian().value_or(0); });
+    for (auto value : wideLive)
+    {
+        if (value >= 2000000000LL)
+            wide.erase(value);
+    }
+    checkMoments(wide, "wide churn, large values erased");
+
+    printf("(median checksums %.6g %.6g)\n", treeMedians, vectorMedians);
+    printf(failures == 0 ? "Moments match the rebuild.\n" : "%d moment checks failed.\n", failures);
+    return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
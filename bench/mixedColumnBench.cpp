@@ -0,0 +1,123 @@
+// Name : Long Duong
+// Date: 10/17/2026
+// Description: Counts the allocations and times the building and rendering of MixedColumn cells. Build from the
+//              repository root with the project's compiler, e.g.
+//                  cl /std:c++20 /O2 /EHsc bench\mixedColumnBench.cpp ui\Table.cpp ui\LineBuffer.cpp
+//                     ui\TextSink.cpp ui\MixedColumn.cpp ui\NumberFormat.cpp
+//              and run with an optional cell count per column, 1000000 by default.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <optional>
+#include <random>
+#include "../ui/Table.h"
+#include "../ui/MixedColumn.h"
+#include "../ui/TextSink.h"
+
+using namespace std;
+
+namespace
+{
+    size_t allocationCount = 0;
+    size_t allocatedBytes = 0;
+}
+
+// Every allocation of the program goes through here so building the columns can be counted.
+void* operator new(size_t size)
+{
+    allocationCount++;
+    allocatedBytes += size;
+    if (void* block = malloc(size == 0 ? 1 : size))
+        return block;
+    throw bad_alloc();
+}
+
+void operator delete(void* block) noexcept
+{
+    free(block);
+}
+
+void operator delete(void* block, size_t) noexcept
+{
+    free(block);
+}
+
+namespace
+{
+    const int REPETITIONS = 5;
+
+    // Takes the rendered text and drops it, so only the rendering is timed.
+    class DiscardSink : public TextSink
+    {
+    public:
+        void write(const wchar_t*, size_t) override {}
+        void flush() override {}
+    };
+
+    struct Measurement
+    {
+        double buildSeconds;
+        double renderSeconds;
+        size_t allocations;
+        size_t bytes;
+    };
+
+    // Builds three columns of n cells (long, double, optional<double>) and renders them once.
+    Measurement measure(size_t n)
+    {
+        mt19937_64 random(1);
+        vector<long> longs(n);
+        vector<double> doubles(n);
+        vector<optional<double>> optionals(n);
+        for (size_t i = 0; i < n; i++)
+        {
+            longs[i] = static_cast<long>(random() % 2000001) - 1000000;
+            doubles[i] = static_cast<double>(random() % 100000) / 1000.0;
+            if (random() % 8 != 0)
+                optionals[i] = static_cast<double>(random() % 1000) / 7.0;
+        }
+
+        size_t allocationsBefore = allocationCount, bytesBefore = allocatedBytes;
+        auto start = chrono::steady_clock::now();
+        auto* longColumn = new MixedColumn(config::DEFAULT_LEFT_PADDING, config::DEFAULT_RIGHT_PADDING, L"Long");
+        auto* doubleColumn = new MixedColumn(config::DEFAULT_LEFT_PADDING, config::DEFAULT_RIGHT_PADDING, L"Double");
+        auto* optionalColumn = new MixedColumn(config::DEFAULT_LEFT_PADDING, config::DEFAULT_RIGHT_PADDING,
+                                               L"Optional");
+        // repeatedAddItems takes its vector by value; moving it in keeps the copy out of the count.
+        longColumn->repeatedAddItems(move(longs));
+        doubleColumn->repeatedAddItems(move(doubles));
+        optionalColumn->repeatedAddItems(move(optionals));
+        Measurement result {};
+        result.buildSeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        result.allocations = allocationCount - allocationsBefore;
+        result.bytes = allocatedBytes - bytesBefore;
+
+        Table table({longColumn, doubleColumn, optionalColumn}, L"", -1, false);
+        DiscardSink sink;
+        start = chrono::steady_clock::now();
+        table.dumpTableTo(sink);
+        result.renderSeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        return result;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    size_t n = argc > 1 ? static_cast<size_t>(strtoull(argv[1], nullptr, 10)) : size_t(1000000);
+    Measurement best = measure(n);
+    for (int repetition = 1; repetition < REPETITIONS; repetition++)
+    {
+        Measurement next = measure(n);
+        best.buildSeconds = min(best.buildSeconds, next.buildSeconds);
+        best.renderSeconds = min(best.renderSeconds, next.renderSeconds);
+    }
+    printf("3 columns of %zu cells, best of %d\n", n, REPETITIONS);
+    printf("allocations while building: %zu\n", best.allocations);
+    printf("bytes allocated: %.1f MB\n", best.bytes / 1e6);
+    printf("build time: %.3f s\n", best.buildSeconds);
+    printf("render time: %.3f s\n", best.renderSeconds);
+    return 0;
+}
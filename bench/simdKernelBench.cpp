@@ -0,0 +1,105 @@
+// Name : Long Duong
+// Date: 10/17/2026
+// Description: Measures the vector reduction kernels against the standard library code they replaced, in elements
+//              per nanosecond. Build from the repository root, e.g.
+//                  g++ -std=c++20 -O2 -pthread bench/simdKernelBench.cpp stats/*.cpp -o simdKernelBench
+//                  cl /std:c++20 /O2 /EHsc bench\simdKernelBench.cpp stats\*.cpp
+//              and run with an optional value count, 16777216 by default.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <vector>
+#include "../stats/simdKernels.h"
+
+using namespace std;
+
+namespace
+{
+    const int REPETITIONS = 5;
+    volatile double sink = 0;
+
+    // Best of REPETITIONS, in elements per nanosecond.
+    double elementsPerNanosecond(size_t n, const function<double()>& run)
+    {
+        double best = 1e300;
+        for (int repetition = 0; repetition < REPETITIONS; repetition++)
+        {
+            auto start = chrono::steady_clock::now();
+            sink = sink + run();
+            best = min(best, chrono::duration<double, nano>(chrono::steady_clock::now() - start).count());
+        }
+        return n / best;
+    }
+
+    // The getters before the kernels: accumulate for the sum, one pow transform_reduce per central moment and
+    // minmax_element.
+    template <typename T>
+    void compare(const char* name, const vector<T>& values)
+    {
+        const T* data = values.data();
+        size_t n = values.size();
+        double mean = static_cast<double>(kernelSum(data, n)) / n;
+
+        double oldSum = elementsPerNanosecond(n, [&]()
+        {
+            return static_cast<double>(accumulate(values.cbegin(), values.cend(), KernelSumType<T>(0)));
+        });
+        double newSum = elementsPerNanosecond(n, [&]() { return static_cast<double>(kernelSum(data, n)); });
+
+        double oldMoments = elementsPerNanosecond(n, [&]()
+        {
+            double result = 0;
+            for (int power = 2; power <= 4; power++)
+                result += transform_reduce(values.cbegin(), values.cend(), 0.0, plus<>(),
+                                           [mean, power](const T& value) { return pow(value - mean, power); });
+            return result;
+        });
+        double newMoments = elementsPerNanosecond(n, [&]() { return kernelCentralSums(data, n, mean).s2; });
+
+        double oldMinMax = elementsPerNanosecond(n, [&]()
+        {
+            auto extremes = minmax_element(values.cbegin(), values.cend());
+            return static_cast<double>(*extremes.first) + static_cast<double>(*extremes.second);
+        });
+        double newMinMax = elementsPerNanosecond(n, [&]()
+        {
+            auto extremes = kernelMinMax(data, n);
+            return static_cast<double>(extremes.first) + static_cast<double>(extremes.second);
+        });
+
+        printf("%-7s sum %5.2f -> %5.2f   moments %5.2f -> %5.2f   minmax %5.2f -> %5.2f\n", name,
+               oldSum, newSum, oldMoments, newMoments, oldMinMax, newMinMax);
+    }
+
+    template <typename T>
+    vector<T> randomValues(size_t n, mt19937_64& random)
+    {
+        vector<T> values(n);
+        for (auto& value : values)
+        {
+            if constexpr (is_integral_v<T>)
+                value = static_cast<T>(random() >> (64 - 8 * sizeof(T) + 1));
+            else
+                value = static_cast<T>(static_cast<double>(random() >> 11) / 1024.0);
+        }
+        return values;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    size_t n = argc > 1 ? static_cast<size_t>(strtoull(argv[1], nullptr, 10)) : size_t(1) << 24;
+    mt19937_64 random(1);
+    printf("%zu values, best of %d, elements/ns, standard library -> kernel\n", n, REPETITIONS);
+    compare("long", randomValues<long>(n, random));
+    compare("int", randomValues<int>(n, random));
+    compare("float", randomValues<float>(n, random));
+    compare("double", randomValues<double>(n, random));
+    return 0;
+}
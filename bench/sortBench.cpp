@@ -0,0 +1,106 @@
+// Name : Long Duong
+// Date: 10/17/2026
+// Description: Times the sort stage algorithms against std::sort on random long long and int values.
+//              Build from the repository root, e.g.
+//                  g++ -std=c++20 -O2 -pthread bench/sortBench.cpp stats/*.cpp -o sortBench
+//                  cl /std:c++20 /O2 /EHsc bench\sortBench.cpp stats\*.cpp
+//              and run with the sizes to time, 1000000 100000000 1000000000 by default. Each size needs about four
+//              times its values in memory; sizes that do not fit are reported and skipped.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <random>
+#include <vector>
+#include "../stats/parallel.h"
+#include "../stats/sorting.h"
+
+using namespace std;
+
+namespace
+{
+    const char* algorithmName(SortAlgorithm algorithm)
+    {
+        switch (algorithm)
+        {
+            case SortAlgorithm::Standard:
+                return "std::sort";
+            case SortAlgorithm::ParallelMerge:
+                return "merge";
+            default:
+                return "radix";
+        }
+    }
+
+    // Sorts a copy of values with every algorithm, once per size past ten million values since the larger runs
+    // take seconds each, and checks every result against std::sort.
+    template <typename T>
+    void compare(const char* name, const vector<T>& values)
+    {
+        const int repetitions = values.size() > 10000000 ? 1 : 3;
+        vector<T> expected;
+        vector<T> work;
+        double standardMilliseconds = 0;
+        for (SortAlgorithm algorithm : {SortAlgorithm::Standard, SortAlgorithm::ParallelMerge, SortAlgorithm::Radix})
+        {
+            double best = 1e300;
+            for (int repetition = 0; repetition < repetitions; repetition++)
+            {
+                work = values;
+                auto start = chrono::steady_clock::now();
+                sortValues(work, algorithm);
+                best = min(best, chrono::duration<double, milli>(chrono::steady_clock::now() - start).count());
+            }
+            if (algorithm == SortAlgorithm::Standard)
+            {
+                standardMilliseconds = best;
+                expected.swap(work);
+                printf("  %-9s %-9s %10.1f ms\n", name, algorithmName(algorithm), best);
+                continue;
+            }
+            if (work != expected)
+            {
+                printf("  %-9s %-9s gave a different order\n", name, algorithmName(algorithm));
+                exit(EXIT_FAILURE);
+            }
+            printf("  %-9s %-9s %10.1f ms   speedup %.2fx\n", name, algorithmName(algorithm), best,
+                   standardMilliseconds / best);
+        }
+    }
+
+    template <typename T>
+    void compareSize(const char* name, size_t n)
+    {
+        try
+        {
+            mt19937_64 random(n);
+            vector<T> values(n);
+            for (auto& value : values)
+                value = static_cast<T>(random());
+            compare(name, values);
+        }
+        catch (const bad_alloc&)
+        {
+            printf("  %-9s skipped, not enough memory\n", name);
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    vector<size_t> sizes;
+    for (int i = 1; i < argc; i++)
+        sizes.push_back(static_cast<size_t>(strtoull(argv[i], nullptr, 10)));
+    if (sizes.empty())
+        sizes = {1000000, 100000000, 1000000000};
+    printf("%zu worker threads\n", workerThreadCount());
+    for (size_t n : sizes)
+    {
+        printf("%zu values\n", n);
+        compareSize<long long>("long long", n);
+        compareSize<int>("int", n);
+    }
+    return 0;
+}
@@ -0,0 +1,71 @@
+// Name : Long Duong
+// Date: 10/17/2026
+// Description: Measures how fast Table renders a long two-column table and one wrapped data cell to a wofstream.
+//              Build from the repository root with the project's compiler, e.g.
+//                  cl /std:c++20 /O2 /EHsc bench\tableRenderBench.cpp ui\Table.cpp ui\LineBuffer.cpp
+//                     ui\TextSink.cpp ui\MixedColumn.cpp ui\NumberFormat.cpp
+//              and run with an optional row count, 1000000 by default.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <vector>
+#include "../ui/Table.h"
+#include "../ui/MixedColumn.h"
+
+using namespace std;
+
+namespace
+{
+    const int REPETITIONS = 5;
+
+    // Best of REPETITIONS, in seconds. Return the number of lines written alongside.
+    pair<double, size_t> renderSeconds(const Table& table, const filesystem::path& path)
+    {
+        double best = 1e300;
+        for (int repetition = 0; repetition < REPETITIONS; repetition++)
+        {
+            wofstream file(path);
+            auto start = chrono::steady_clock::now();
+            table.dumpTableTo(file);
+            best = min(best, chrono::duration<double>(chrono::steady_clock::now() - start).count());
+        }
+        ifstream written(path, ios::binary);
+        size_t lines = count(istreambuf_iterator<char>(written), istreambuf_iterator<char>(), '\n');
+        return {best, lines};
+    }
+}
+
+int main(int argc, char** argv)
+{
+    size_t rows = argc > 1 ? static_cast<size_t>(strtoull(argv[1], nullptr, 10)) : size_t(1000000);
+    filesystem::path path = filesystem::temp_directory_path() / "tableRenderBench.txt";
+    mt19937_64 random(1);
+
+    auto* longs = new MixedColumn(config::DEFAULT_LEFT_PADDING, config::DEFAULT_RIGHT_PADDING, L"Value");
+    auto* doubles = new MixedColumn(config::DEFAULT_LEFT_PADDING, config::DEFAULT_RIGHT_PADDING, L"Share");
+    for (size_t row = 0; row < rows; row++)
+    {
+        longs->addItems(static_cast<long>(random() % 2000001) - 1000000);
+        doubles->addItems(static_cast<double>(random() % 100000) / 1000.0);
+    }
+    Table rowTable({longs, doubles}, L"Rows");
+    double rowSeconds = renderSeconds(rowTable, path).first;
+    printf("%zu-row two-column table: %.3f s, %.0f rows/s\n", rows, rowSeconds, rows / rowSeconds);
+
+    vector<long> data(rows);
+    for (auto& value : data)
+        value = static_cast<long>(random() % 2000001) - 1000000;
+    Table dataTable({new MixedColumn(config::DEFAULT_LEFT_PADDING, config::DEFAULT_RIGHT_PADDING, L"", data)},
+                    L"Data");
+    auto [dataSeconds, dataLines] = renderSeconds(dataTable, path);
+    printf("%zu-value wrapped data cell: %.3f s, %zu lines, %.0f lines/s\n", rows, dataSeconds, dataLines,
+           dataLines / dataSeconds);
+
+    filesystem::remove(path);
+    return 0;
+}
@@ -0,0 +1,85 @@
+// Name : Long Duong
+// Date: 10/17/2026
+// Description: Measures how fast a 1M-value data table reaches a file and standard output through a wide stream
+//              and through Utf8FileSink. Build from the repository root with the project's compiler, e.g.
+//                  cl /std:c++20 /O2 /EHsc bench\textSinkBench.cpp ui\Table.cpp ui\LineBuffer.cpp
+//                     ui\TextSink.cpp ui\MixedColumn.cpp ui\NumberFormat.cpp
+//              and run with standard output redirected, e.g. textSinkBench > out.txt, and an optional value count,
+//              1000000 by default. The results go to standard error.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "../ui/Table.h"
+#include "../ui/SpanColumn.h"
+#include "../ui/TextSink.h"
+
+using namespace std;
+
+namespace
+{
+    const int REPETITIONS = 5;
+
+    // Best of REPETITIONS, in seconds.
+    double bestSeconds(const function<void()>& run)
+    {
+        double best = 1e300;
+        for (int repetition = 0; repetition < REPETITIONS; repetition++)
+        {
+            auto start = chrono::steady_clock::now();
+            run();
+            best = min(best, chrono::duration<double>(chrono::steady_clock::now() - start).count());
+        }
+        return best;
+    }
+
+    void report(const char* target, double megabytes, double wideSeconds, double utf8Seconds)
+    {
+        fprintf(stderr, "%-16s wide stream %7.1f MB/s   Utf8FileSink %7.1f MB/s\n", target, megabytes / wideSeconds,
+                megabytes / utf8Seconds);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    size_t n = argc > 1 ? static_cast<size_t>(strtoull(argv[1], nullptr, 10)) : size_t(1000000);
+    filesystem::path path = filesystem::temp_directory_path() / "textSinkBench.txt";
+    mt19937_64 random(1);
+    vector<long> data(n);
+    for (auto& value : data)
+        value = static_cast<long>(random() % 2000001) - 1000000;
+    Table table({new SpanColumn<long>(config::DEFAULT_LEFT_PADDING, config::DEFAULT_RIGHT_PADDING, L"",
+                                      span<const long>(data))}, L"Data");
+
+    double fileWide = bestSeconds([&]()
+    {
+        wofstream file(path);
+        table.dumpTableTo(file);
+    });
+    double fileUtf8 = bestSeconds([&]()
+    {
+        Utf8FileSink file(path.string());
+        table.dumpTableTo(file);
+    });
+    double megabytes = filesystem::file_size(path) / 1e6;
+    fprintf(stderr, "%zu values, %.1f MB of text, best of %d\n", n, megabytes, REPETITIONS);
+    report("file", megabytes, fileWide, fileUtf8);
+
+    double consoleWide = bestSeconds([&]() { table.dumpTableTo(wcout); });
+    double consoleUtf8 = bestSeconds([&]()
+    {
+        Utf8FileSink console(1);
+        table.dumpTableTo(console);
+    });
+    report("standard output", megabytes, consoleWide, consoleUtf8);
+
+    filesystem::remove(path);
+    return 0;
+}
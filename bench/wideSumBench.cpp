@@ -0,0 +1,84 @@
+// Name : Long Duong
+// Date: 10/17/2026
+// Description: Measures the overflow free and compensated sums against the naive kernel sums they replaced.
+//              Build from the repository root, e.g.
+//                  g++ -std=c++20 -O2 -pthread bench/wideSumBench.cpp stats/*.cpp -o wideSumBench
+//                  cl /std:c++20 /O2 /EHsc bench\wideSumBench.cpp stats\*.cpp
+//              and run with an optional value count, 100000000 by default.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <random>
+#include <vector>
+#include "../stats/parallel.h"
+#include "../stats/simdKernels.h"
+#include "../stats/wideSum.h"
+
+using namespace std;
+
+namespace
+{
+    const int REPETITIONS = 5;
+
+    // Best of REPETITIONS, in milliseconds.
+    double bestMilliseconds(const function<void()>& run)
+    {
+        double best = 1e300;
+        for (int repetition = 0; repetition < REPETITIONS; repetition++)
+        {
+            auto start = chrono::steady_clock::now();
+            run();
+            best = min(best, chrono::duration<double, milli>(chrono::steady_clock::now() - start).count());
+        }
+        return best;
+    }
+
+    // The path getSum took before: the vector kernels summing in long long or double, reduced on the pool.
+    template <typename T>
+    KernelSumType<T> naiveSum(const vector<T>& values)
+    {
+        return parallelReduce(
+            values.size(), KernelSumType<T>(0),
+            [&values](size_t first, size_t last) { return kernelSum(values.data() + first, last - first); },
+            plus<>()
+        );
+    }
+
+    template <typename T>
+    void compare(const char* name, const vector<T>& values)
+    {
+        volatile double sink = 0;
+        double naive = bestMilliseconds([&]() { sink = sink + static_cast<double>(naiveSum(values)); });
+        double wide = bestMilliseconds([&]() { sink = sink + static_cast<double>(wideSum(values.data(), values.size())); });
+        printf("%-10s naive %8.1f ms   wide %8.1f ms   %.2fx\n", name, naive, wide, wide / naive);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    size_t n = argc > 1 ? static_cast<size_t>(strtoull(argv[1], nullptr, 10)) : size_t(100000000);
+    mt19937_64 random(1);
+    printf("%zu values, best of %d\n", n, REPETITIONS);
+    {
+        vector<long long> values(n);
+        for (auto& value : values)
+            value = static_cast<long long>(random() >> 8);
+        compare("long long", values);
+    }
+    {
+        vector<int> values(n);
+        for (auto& value : values)
+            value = static_cast<int>(random());
+        compare("int", values);
+    }
+    {
+        vector<double> values(n);
+        for (auto& value : values)
+            value = static_cast<double>(random() >> 11) / 1024.0;
+        compare("double", values);
+    }
+    return 0;
+}
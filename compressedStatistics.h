@@ -0,0 +1,464 @@
+// Name : Long Duong
+// Date: 10/17/2026
+// Description: A sibling of Statistics that keeps its sorted integer values bit-packed in memory.
+
+#ifndef PROJ1_COMPRESSEDSTATISTICS_H
+#define PROJ1_COMPRESSEDSTATISTICS_H
+
+#include <vector>
+#include <optional>
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <chrono>
+#include "statistics.h"
+#include "ui/UIExcept.h"
+#include "ui/configuration.h"
+#include "stats/numberParsing.h"
+#include "stats/sorting.h"
+#include "stats/parallel.h"
+#include "stats/ExternalSort.h"
+#include "stats/PackedSortedArray.h"
+#include "stats/Moments.h"
+#include "stats/simdKernels.h"
+#include "stats/wideSum.h"
+#include "stats/quantiles.h"
+
+using namespace std;
+
+// The sorted values live in a PackedSortedArray, a few bits per value instead of sizeof(T) bytes. Order statistics
+// read single values in O(1), rank and outlier queries binary search the skip index, and reductions decode the
+// blocks on the worker threads. Loading goes through an ExternalSort, so the uncompressed values are never held in
+// memory beyond config::EXTERNAL_MEMORY_BUDGET_MB.
+template <typename T>
+class CompressedStatistics
+{
+public:
+    using Quartiles = typename Statistics<T>::Quartiles;
+    using FrequencyEntry = typename Statistics<T>::FrequencyEntry;
+    using LoadReport = typename Statistics<T>::LoadReport;
+
+    CompressedStatistics() = default;
+
+    // Preconditions: None
+    // Postconditions: Instance holds the values, sorted and packed.
+    explicit CompressedStatistics(vector<T> values)
+    {
+        sortValues(values, SortAlgorithm::Radix);
+        packed = PackedSortedArray<T>(values.data(), values.size());
+        summarize();
+    }
+
+    // Preconditions: A path to a text file
+    // Postconditions: Instance holds the values of the file, sorted and packed. Throw exception if file cannot be
+    //                 opened.
+    void loadDataFromFilePath(string path)
+    {
+        ifstream statsFile(path, ios::in | ios::binary);
+        if (!statsFile.is_open())
+            throw UIExcept("Cannot open file");
+        clear();
+
+        auto parseStart = chrono::steady_clock::now();
+        ExternalSort<T> sorter(static_cast<size_t>(config::EXTERNAL_MEMORY_BUDGET_MB) << 20);
+        size_t bytesRead = parseStreamInChunks<T>(statsFile, [&sorter](const vector<T>& values)
+        {
+            for (const auto& value : values)
+                sorter.push(value);
+        });
+        sorter.finish();
+        sorter.merge([this](const T& value)
+        {
+            packed.push_back(value);
+            return true;
+        });
+        packed.finish();
+        summarize();
+        chrono::duration<double> parseTime = chrono::steady_clock::now() - parseStart;
+
+        _loadReport.bytesRead = bytesRead;
+        _loadReport.valuesParsed = getSize();
+        _loadReport.parseSeconds = parseTime.count();
+        _loadReport.valuesPerSecond = parseTime.count() > 0 ? getSize() / parseTime.count() : 0;
+    }
+
+    // Preconditions: loadDataFromFilePath was called.
+    // Postconditions: Return the size and parse throughput of the last load, sorting and packing included.
+    const LoadReport& getLoadReport() const
+    {
+        return _loadReport;
+    }
+
+    // Preconditions: None
+    // Postconditions: Return the bytes held by the packed values, to compare with getSize() * sizeof(T).
+    size_t getMemoryUsage() const
+    {
+        return packed.memoryBytes();
+    }
+
+    // Preconditions: None
+    // Postconditions: Internal states are cleared to prepare for new data.
+    void clear()
+    {
+        *this = CompressedStatistics();
+    }
+
+    // Preconditions: Instance holds more than 0 value.
+    // Postconditions: Return the minimum
+    T getMin() const
+    {
+        return packed[0];
+    }
+
+    // Preconditions: Instance holds more than 0 value.
+    // Postconditions: Return maximum
+    T getMax() const
+    {
+        return packed[packed.size() - 1];
+    }
+
+    // Preconditions: Instance holds more than 0 value.
+    // Postconditions: Return range
+    T getRange() const
+    {
+        return getMax() - getMin();
+    }
+
+    // Preconditions: Instance holds more than 0 value.
+    // Postconditions: Return sum of all values, exact in 128 bits for integers.
+    WideSumType<T> getSum() const
+    {
+        return sum.value();
+    }
+
+    // Preconditions: None
+    // Postconditions: Return number of values.
+    size_t getSize() const
+    {
+        return packed.size();
+    }
+
+    // Preconditions: Instance holds more than 0 value.
+    // Postconditions: Return the mean of all values.
+    double getMean() const
+    {
+        return static_cast<double>(getSum()) / getSize();
+    }
+
+    // Preconditions: Instance holds more than 0 value.
+    // Postconditions: Return an optional that contains the median if exist and nullopt otherwise.
+    optional<double> getMedian() const
+    {
+        return getMedianInRange(0, getSize());
+    }
+
+    // Preconditions: Instance holds more than 0 value.
+    // Postconditions: Return the mode.
+    vector<T> getMode() const
+    {
+        const auto& freqTable = getFrequencyTable();
+        long maxFrequency = 0;
+        for (const auto& entry : freqTable)
+            maxFrequency = max(maxFrequency, entry.frequency);
+        auto modeElements = vector<T>();
+        for (const auto& entry : freqTable)
+        {
+            if (entry.frequency >= maxFrequency)
+                modeElements.push_back(entry.value);
+        }
+        return modeElements;
+    }
+
+    // Preconditions: None
+    // Postconditions: Return the number of distinct values.
+    size_t getDistinctCount() const
+    {
+        return getFrequencyTable().size();
+    }
+
+    // Preconditions: Instance holds more than 0 value.
+    // Postconditions: Return count, mean and central moment sums, computed once after loading.
+    const Moments& getMoments() const
+    {
+        return moments;
+    }
+
+    // Preconditions: Instance holds more than 0 value.
+    // Postconditions: Return the variance
+    double getVariance() const
+    {
+        return moments.getM2() / (getSize() - 1);
+    }
+
+    // Preconditions: Instance holds more than 0 value.
+    // Postconditions: Return the standard deviation
+    double getStandardDeviation() const
+    {
+        return sqrt(getVariance());
+    }
+
+    // Preconditions: Instance holds more than 0 value.
+    // Postconditions: Return the midRange
+    double getMidRange() const
+    {
+        return (getMax() + getMin()) / 2.0;
+    }
+
+    // Preconditions: Instance holds more than 0 value.
+    // Postconditions: Return the quartiles with the median-of-halves definition of Statistics.
+    const Quartiles& getQuartiles() const
+    {
+        if (!_quartilesCache.has_value())
+        {
+            size_t count = getSize();
+            size_t half = count / 2;
+            _quartilesCache.emplace(Quartiles {
+                .Q1 = getMedianInRange(0, half),
+                .Q2 = getMedianInRange(0, count),
+                .Q3 = getMedianInRange(count % 2 == 0 ? half : half + 1, count)
+            });
+        }
+        return _quartilesCache.value();
+    }
+
+    // Preconditions: Instance holds more than 0 value.
+    // Postconditions: Return the IQR if it exists, otherwise nullopt
+    optional<double> getIQR() const
+    {
+        auto& quartiles = getQuartiles();
+        if (!quartiles.Q3.has_value() || !quartiles.Q1.has_value())
+            return nullopt;
+        return quartiles.Q3.value() - quartiles.Q1.value();
+    }
+
+    // Preconditions: Instance holds more than 0 value.
+    // Postconditions: Return outlierFence if IQR exists, nullopt otherwise.
+    optional<pair<double, double>> getOutlierFence() const
+    {
+        auto iqr = getIQR();
+        if (!iqr.has_value()) return nullopt;
+        const auto& q = getQuartiles();
+        return make_pair(q.Q1.value() - 1.5 * iqr.value(), q.Q3.value() + 1.5 * iqr.value());
+    }
+
+    // Preconditions: Instance holds more than 0 value.
+    // Postconditions: Return the number of outliers in O(log n).
+    size_t getOutlierCount() const
+    {
+        auto fence = getOutlierFence();
+        if (!fence.has_value())
+            return 0;
+        size_t lowEnd = packed.lowerBound(fence->first);
+        return lowEnd + (getSize() - max(lowEnd, packed.upperBound(fence->second)));
+    }
+
+    // Preconditions: Instance holds more than 0 value.
+    // Postconditions: Return the outliers in ascending order.
+    vector<T> getOutliers() const
+    {
+        auto outliers = vector<T>();
+        auto fence = getOutlierFence();
+        if (!fence.has_value())
+            return outliers;
+        size_t lowEnd = packed.lowerBound(fence->first);
+        size_t highBegin = max(lowEnd, packed.upperBound(fence->second));
+        for (size_t i = 0; i < lowEnd; i++)
+            outliers.push_back(packed[i]);
+        for (size_t i = highBegin; i < getSize(); i++)
+            outliers.push_back(packed[i]);
+        return outliers;
+    }
+
+    // Preconditions: Instance holds more than 0 value.
+    // Postconditions: Return sumOfSquares.
+    double getSumOfSquares() const
+    {
+        return moments.getM2();
+    }
+
+    // Preconditions: Instance holds more than 0 value.
+    // Postconditions: Return mean absolute deviation, decoding the blocks in parallel.
+    double getMeanAbsoluteDeviation() const
+    {
+        double mean = getMean();
+        double deviationSum = reduceBlocks(0.0, [mean](const T* values, size_t n)
+        {
+            double partial = 0.0;
+            for (size_t i = 0; i < n; i++)
+                partial += abs(values[i] - mean);
+            return partial;
+        }, plus<>());
+        return deviationSum / getSize();
+    }
+
+    // Preconditions: Instance holds more than 0 value.
+    // Postconditions: Return the root mean square
+    double getRootMeanSquare() const
+    {
+        return sqrt(moments.getMean() * moments.getMean() + moments.getM2() / getSize());
+    }
+
+    // Preconditions: Instance holds more than 0 value.
+    // Postconditions: Return standard error of the mean
+    double getStdErrorOfMean() const
+    {
+        return getStandardDeviation() / sqrt(getSize());
+    }
+
+    // Preconditions: Instance holds more than 0 value.
+    // Postconditions: Return coefficient of variantion
+    double getCoefficientOfVariation() const
+    {
+        return getStandardDeviation() / getMean();
+    }
+
+    // Preconditions: Instance holds more than 0 value.
+    // Postconditions: Return relative standard deviation.
+    double getRelativeStd() const
+    {
+        return (100.0 * getStandardDeviation()) / getMean();
+    }
+
+    // Preconditions: Instance holds more than 0 value.
+    // Postconditions: Return skewness
+    optional<double> getSkewness() const
+    {
+        double n = static_cast<double>(getSize());
+        if (n * pow(getStandardDeviation(), 3) == 0.0 || (n - 1)*(n - 2) == 0.0)
+            return nullopt;
+        double coefficient = n / ((n - 1) * (n - 2));
+        return coefficient * moments.getM3() / pow(getStandardDeviation(), 3);
+    }
+
+    // Preconditions: Instance holds more than 0 value.
+    // Postconditions: Return kurtosis.
+    optional<double> getKurtosis() const
+    {
+        double n = static_cast<double>(getSize());
+        if (pow(getStandardDeviation(), 4) == 0.0 || (n - 1)*(n - 2)*(n - 3) == 0.0)
+            return nullopt;
+        double coefficient = n * (n + 1) / ((n - 1) * (n - 2) * (n - 3));
+        return coefficient * moments.getM4() / pow(getStandardDeviation(), 4);
+    }
+
+    // Preconditions: Instance holds more than 0 value.
+    // Postconditions: Return kurtosis excess
+    optional<double> getKurtosisExcess() const
+    {
+        double n = static_cast<double>(getSize());
+        if (!getKurtosis().has_value() || (n - 2) * (n - 3) == 0)
+            return nullopt;
+        double adjustmentTerm = -3* (n - 1) * (n - 1) / ((n - 2) * (n - 3));
+        return getKurtosis().value() + adjustmentTerm;
+    }
+
+    // Preconditions: Instance holds more than 0 value.
+    // Postconditions: Return a vector of struct that contains value, frequency, and frequency percentage, built
+    //                 once from the runs of the decoded blocks and cached.
+    const vector<FrequencyEntry>& getFrequencyTable() const
+    {
+        if (_frequencyTableCache.has_value())
+            return _frequencyTableCache.value();
+
+        double totalFrequency = static_cast<double>(getSize());
+        auto frequencyTable = vector<FrequencyEntry>();
+        T block[PackedSortedArray<T>::BLOCK_SIZE];
+        for (size_t b = 0; b < packed.getBlockCount(); b++)
+        {
+            size_t length = packed.decodeBlock(b, block);
+            for (size_t i = 0; i < length; i++)
+            {
+                if (frequencyTable.empty() || frequencyTable.back().value != block[i])
+                    frequencyTable.push_back(FrequencyEntry{ .value = block[i], .frequency = 0, .frequencyPercentage = 0 });
+                frequencyTable.back().frequency++;
+            }
+        }
+        for (auto& entry : frequencyTable)
+            entry.frequencyPercentage = entry.frequency / totalFrequency;
+        _frequencyTableCache.emplace(move(frequencyTable));
+        return _frequencyTableCache.value();
+    }
+
+    // Preconditions: None
+    // Postconditions: Return the number of values strictly less than value.
+    size_t getRank(const T& value) const
+    {
+        return packed.lowerBound(value);
+    }
+
+    // Preconditions: Instance holds more than 0 value.
+    // Postconditions: Return the percentage of values less than or equal to value.
+    double getPercentileRank(const T& value) const
+    {
+        return 100.0 * packed.upperBound(value) / getSize();
+    }
+
+    // Preconditions: None
+    // Postconditions: Return the number of values in [low, high].
+    size_t getCountInRange(const T& low, const T& high) const
+    {
+        if (high < low)
+            return 0;
+        return packed.upperBound(high) - packed.lowerBound(low);
+    }
+
+protected:
+    PackedSortedArray<T> packed;
+    Moments moments;
+    WideAccumulator<T> sum;
+    LoadReport _loadReport {};
+
+    mutable optional<Quartiles> _quartilesCache;
+    mutable optional<vector<FrequencyEntry>> _frequencyTableCache;
+
+    /// Helpers
+    // Preconditions: reduceBlock(values, n) returns the partial result of n decoded values and combine merges two
+    //                partial results, the left one covering lower indices.
+    // Postconditions: Return the reduction over every value, each worker decoding its own blocks.
+    template <typename Result, typename ReduceBlock, typename Combine>
+    Result reduceBlocks(Result identity, ReduceBlock&& reduceBlock, Combine&& combine) const
+    {
+        return parallelReduce(
+            packed.getBlockCount(), identity,
+            [this, &identity, &reduceBlock, &combine](size_t first, size_t last)
+            {
+                T block[PackedSortedArray<T>::BLOCK_SIZE];
+                Result partial = identity;
+                for (size_t b = first; b < last; b++)
+                    partial = combine(partial, reduceBlock(static_cast<const T*>(block), packed.decodeBlock(b, block)));
+                return partial;
+            },
+            combine
+        );
+    }
+
+    // Preconditions: packed holds the values.
+    // Postconditions: sum and moments are computed in one parallel pass over the blocks.
+    void summarize()
+    {
+        using Summary = pair<WideAccumulator<T>, Moments>;
+        auto summary = reduceBlocks(Summary(WideAccumulator<T>(), Moments()), [](const T* values, size_t n)
+        {
+            WideAccumulator<T> blockSum;
+            blockSum.addBlock(values, n);
+            double pivot = static_cast<double>(blockSum.value()) / n;
+            CentralSums sums = kernelCentralSums(values, n, pivot);
+            return Summary(blockSum, Moments::fromShiftedSums(n, pivot, sums.s1, sums.s2, sums.s3, sums.s4));
+        }, [](Summary left, const Summary& right)
+        {
+            left.first.merge(right.first);
+            left.second.merge(right.second);
+            return left;
+        });
+        sum = summary.first;
+        moments = summary.second;
+    }
+
+    // Same definition as Statistics::getMedianInRange over the ranks [lowRank, highRank) of the sorted values.
+    optional<double> getMedianInRange(size_t lowRank, size_t highRank) const
+    {
+        return medianOfRankRange(lowRank, highRank, [this](uint64_t rank) { return packed[rank]; });
+    }
+};
+
+#endif //PROJ1_COMPRESSEDSTATISTICS_H
@@ -0,0 +1,468 @@
+// Name : Long Duong
+// Date: 10/17/2026
+// Description: A sibling of Statistics whose values can be inserted and erased one at a time in O(log n).
+
+#ifndef PROJ1_DYNAMICSTATISTICS_H
+#define PROJ1_DYNAMICSTATISTICS_H
+
+#include <vector>
+#include <optional>
+#include <algorithm>
+#include <cmath>
+#include <chrono>
+#include "statistics.h"
+#include "ui/UIExcept.h"
+#include "stats/MappedFile.h"
+#include "stats/numberParsing.h"
+#include "stats/sorting.h"
+#include "stats/Moments.h"
+#include "stats/OrderStatisticTree.h"
+#include "stats/quantiles.h"
+
+using namespace std;
+
+// Values live in an order statistic tree of (value, count) nodes instead of a sorted vector, so insert and erase
+// cost O(log n) where Statistics would shift O(n) elements. Median, quartiles, ranks and range sums are answered
+// by walking the tree in O(log n), the mode in O(modes * log n). Moments follow every insert and erase in O(1).
+template <typename T>
+class DynamicStatistics
+{
+public:
+    using Quartiles = typename Statistics<T>::Quartiles;
+    using FrequencyEntry = typename Statistics<T>::FrequencyEntry;
+    using LoadReport = typename Statistics<T>::LoadReport;
+
+    // Preconditions: A path to a text file
+    // Postconditions: Instance holds the values of the file, parsed like LoadMode::MemoryMapped, sorted once and
+    //                 built into the tree in O(n). Throw exception if file cannot be opened.
+    void loadDataFromFilePath(string path)
+    {
+        auto parseStart = chrono::steady_clock::now();
+        MappedFile file(path);
+        clear();
+        vector<T> values;
+        values.reserve(estimateNumberCount(file.begin(), file.end()));
+        bool stoppedEarly;
+        parseNumbers(file.begin(), file.end(), values, stoppedEarly);
+        chrono::duration<double> parseTime = chrono::steady_clock::now() - parseStart;
+
+        sortValues(values, SortAlgorithm::Radix);
+        vector<pair<T, uint64_t>> runs;
+        for (const auto& value : values)
+        {
+            if (runs.empty() || runs.back().first != value)
+                runs.emplace_back(value, 0);
+            runs.back().second++;
+            moments.push(static_cast<double>(value));
+        }
+        tree.assign(runs);
+
+        _loadReport.bytesRead = file.size();
+        _loadReport.valuesParsed = values.size();
+        _loadReport.parseSeconds = parseTime.count();
+        _loadReport.valuesPerSecond = parseTime.count() > 0 ? values.size() / parseTime.count() : 0;
+    }
+
+    // Preconditions: None
+    // Postconditions: value is added in O(log n).
+    void insert(const T& value)
+    {
+        tree.insert(value);
+        moments.push(static_cast<double>(value));
+        _quartilesCache.reset();
+    }
+
+    // Preconditions: None
+    // Postconditions: One occurrence of value is removed in O(log n). Return false if value does not occur.
+    bool erase(const T& value)
+    {
+        if (tree.erase(value) == 0)
+            return false;
+        // The removal formula loses precision as the count shrinks, so the last value resets the moments exactly.
+        if (tree.getCount() == 0)
+        {
+            moments = Moments();
+            erasedSquares = 0.0;
+        }
+        else
+        {
+            double deviation = static_cast<double>(value) - moments.getMean();
+            erasedSquares += deviation * deviation;
+            moments.remove(static_cast<double>(value));
+        }
+        _quartilesCache.reset();
+        return true;
+    }
+
+    // Preconditions: None
+    // Postconditions: Moments are recomputed from the values in O(distinct), dropping the rounding that many erase
+    //                 calls accumulate.
+    void recomputeMoments()
+    {
+        rebuildMoments();
+    }
+
+    // Preconditions: loadDataFromFilePath was called.
+    // Postconditions: Return the size and parse throughput of the last load.
+    const LoadReport& getLoadReport() const
+    {
+        return _loadReport;
+    }
+
+    // Preconditions: None
+    // Postconditions: Internal states are cleared to prepare for new data.
+    void clear()
+    {
+        tree.clear();
+        moments = Moments();
+        erasedSquares = 0.0;
+        _quartilesCache.reset();
+    }
+
+    // Preconditions: Instance holds more than 0 value.
+    // Postconditions: Return the minimum
+    const T& getMin() const
+    {
+        return tree.getMin();
+    }
+
+    // Preconditions: Instance holds more than 0 value.
+    // Postconditions: Return maximum
+    const T& getMax() const
+    {
+        return tree.getMax();
+    }
+
+    // Preconditions: Instance holds more than 0 value.
+    // Postconditions: Return range
+    T getRange() const
+    {
+        return getMax() - getMin();
+    }
+
+    // Preconditions: Instance holds more than 0 value.
+    // Postconditions: Return sum of all values.
+    WideSumType<T> getSum() const
+    {
+        return tree.getSum();
+    }
+
+    // Preconditions: None
+    // Postconditions: Return number of values.
+    size_t getSize() const
+    {
+        return static_cast<size_t>(tree.getCount());
+    }
+
+    // Preconditions: Instance holds more than 0 value.
+    // Postconditions: Return the mean of all values.
+    double getMean() const
+    {
+        return static_cast<double>(getSum()) / getSize();
+    }
+
+    // Preconditions: Instance holds more than 0 value.
+    // Postconditions: Return an optional that contains the median if exist and nullopt otherwise.
+    optional<double> getMedian() const
+    {
+        return getMedianInRange(0, getSize());
+    }
+
+    // Preconditions: Instance holds more than 0 value.
+    // Postconditions: Return the mode.
+    vector<T> getMode() const
+    {
+        return tree.getModes();
+    }
+
+    // Preconditions: None
+    // Postconditions: Return the number of distinct values.
+    size_t getDistinctCount() const
+    {
+        return tree.getDistinctCount();
+    }
+
+    // Preconditions: None
+    // Postconditions: Return how many times value occurs.
+    size_t getFrequency(const T& value) const
+    {
+        return static_cast<size_t>(tree.countOf(value));
+    }
+
+    // Preconditions: Instance holds more than 0 value.
+    // Postconditions: Return count, mean and central moment sums, kept up to date by insert and erase. They are
+    //                 rebuilt from the tree first when erase has taken out more than config::MOMENT_DRIFT_RATIO
+    //                 times the remaining sum of squared deviations, since the rounding of those removals would
+    //                 then dominate what is left.
+    const Moments& getMoments() const
+    {
+        if (!(erasedSquares <= moments.getM2() * config::MOMENT_DRIFT_RATIO))
+            rebuildMoments();
+        return moments;
+    }
+
+    // Preconditions: Instance holds more than 0 value.
+    // Postconditions: Return the variance
+    double getVariance() const
+    {
+        return getMoments().getM2() / (getSize() - 1);
+    }
+
+    // Preconditions: Instance holds more than 0 value.
+    // Postconditions: Return the standard deviation
+    double getStandardDeviation() const
+    {
+        return sqrt(getVariance());
+    }
+
+    // Preconditions: Instance holds more than 0 value.
+    // Postconditions: Return the midRange
+    double getMidRange() const
+    {
+        return (getMax() + getMin()) / 2.0;
+    }
+
+    // Preconditions: Instance holds more than 0 value.
+    // Postconditions: Return the quartiles with the same median-of-halves definition as Statistics, each index
+    //                 into the sorted values answered by the tree.
+    const Quartiles& getQuartiles() const
+    {
+        if (!_quartilesCache.has_value())
+        {
+            size_t count = getSize();
+            size_t half = count / 2;
+            _quartilesCache.emplace(Quartiles {
+                .Q1 = getMedianInRange(0, half),
+                .Q2 = getMedianInRange(0, count),
+                .Q3 = getMedianInRange(count % 2 == 0 ? half : half + 1, count)
+            });
+        }
+        return _quartilesCache.value();
+    }
+
+    // Preconditions: Instance holds more than 0 value.
+    // Postconditions: Return the IQR if it exists, otherwise nullopt
+    optional<double> getIQR() const
+    {
+        auto& quartiles = getQuartiles();
+        if (!quartiles.Q3.has_value() || !quartiles.Q1.has_value())
+            return nullopt;
+        return quartiles.Q3.value() - quartiles.Q1.value();
+    }
+
+    // Preconditions: Instance holds more than 0 value.
+    // Postconditions: Return outlierFence if IQR exists, nullopt otherwise.
+    optional<pair<double, double>> getOutlierFence() const
+    {
+        auto iqr = getIQR();
+        if (!iqr.has_value()) return nullopt;
+        const auto& q = getQuartiles();
+        return make_pair(q.Q1.value() - 1.5 * iqr.value(), q.Q3.value() + 1.5 * iqr.value());
+    }
+
+    // Preconditions: Instance holds more than 0 value.
+    // Postconditions: Return the number of outliers in O(log n).
+    size_t getOutlierCount() const
+    {
+        auto fence = getOutlierFence();
+        if (!fence.has_value())
+            return 0;
+        uint64_t low = tree.countAndSumBelow(fence->first).first;
+        uint64_t high = tree.getCount() - tree.countAndSumAtOrBelow(fence->second).first;
+        return static_cast<size_t>(low + high);
+    }
+
+    // Preconditions: Instance holds more than 0 value.
+    // Postconditions: Return the outliers in ascending order, visiting only the subtrees beyond the fences.
+    vector<T> getOutliers() const
+    {
+        auto outliers = vector<T>();
+        auto fence = getOutlierFence();
+        if (!fence.has_value())
+            return outliers;
+        auto append = [&outliers](const T& value, uint64_t count) { outliers.insert(outliers.end(), count, value); };
+        tree.forEachBelow(fence->first, append);
+        tree.forEachAbove(fence->second, append);
+        return outliers;
+    }
+
+    // Preconditions: Instance holds more than 0 value.
+    // Postconditions: Return sumOfSquares.
+    double getSumOfSquares() const
+    {
+        return getMoments().getM2();
+    }
+
+    // Preconditions: Instance holds more than 0 value.
+    // Postconditions: Return mean absolute deviation in O(log n). Sums are shifted by the median in WideSumType<T>
+    //                 before they become doubles, so large values do not cancel: with c values below the mean and,
+    //                 after the shift, mean m, sum s below the mean and total t,
+    //                 sum |x - mean| = (c * m - s) + ((t - s) - (n - c) * m).
+    double getMeanAbsoluteDeviation() const
+    {
+        uint64_t count = tree.getCount();
+        T median = tree.valueAtRank(count / 2);
+        WideSumType<T> shiftedTotal = tree.getSum() - WideSumType<T>(median) * count;
+        double meanOffset = static_cast<double>(shiftedTotal) / count;
+        auto [countBelow, sumBelow] = tree.countAndSumBelow(ShiftedBound {median, meanOffset});
+        WideSumType<T> shiftedBelow = sumBelow - WideSumType<T>(median) * countBelow;
+        double below = static_cast<double>(shiftedBelow);
+        double above = static_cast<double>(shiftedTotal - shiftedBelow);
+        double deviationSum = (countBelow * meanOffset - below) + (above - (count - countBelow) * meanOffset);
+        return deviationSum / count;
+    }
+
+    // Preconditions: Instance holds more than 0 value.
+    // Postconditions: Return the root mean square
+    double getRootMeanSquare() const
+    {
+        return sqrt(getMoments().getMean() * getMoments().getMean() + getMoments().getM2() / getSize());
+    }
+
+    // Preconditions: Instance holds more than 0 value.
+    // Postconditions: Return standard error of the mean
+    double getStdErrorOfMean() const
+    {
+        return getStandardDeviation() / sqrt(getSize());
+    }
+
+    // Preconditions: Instance holds more than 0 value.
+    // Postconditions: Return coefficient of variantion
+    double getCoefficientOfVariation() const
+    {
+        return getStandardDeviation() / getMean();
+    }
+
+    // Preconditions: Instance holds more than 0 value.
+    // Postconditions: Return relative standard deviation.
+    double getRelativeStd() const
+    {
+        return (100.0 * getStandardDeviation()) / getMean();
+    }
+
+    // Preconditions: Instance holds more than 0 value.
+    // Postconditions: Return skewness
+    optional<double> getSkewness() const
+    {
+        double n = static_cast<double>(getSize());
+        if (n * pow(getStandardDeviation(), 3) == 0.0 || (n - 1)*(n - 2) == 0.0)
+            return nullopt;
+        double coefficient = n / ((n - 1) * (n - 2));
+        return coefficient * getMoments().getM3() / pow(getStandardDeviation(), 3);
+    }
+
+    // Preconditions: Instance holds more than 0 value.
+    // Postconditions: Return kurtosis.
+    optional<double> getKurtosis() const
+    {
+        double n = static_cast<double>(getSize());
+        if (pow(getStandardDeviation(), 4) == 0.0 || (n - 1)*(n - 2)*(n - 3) == 0.0)
+            return nullopt;
+        double coefficient = n * (n + 1) / ((n - 1) * (n - 2) * (n - 3));
+        return coefficient * getMoments().getM4() / pow(getStandardDeviation(), 4);
+    }
+
+    // Preconditions: Instance holds more than 0 value.
+    // Postconditions: Return kurtosis excess
+    optional<double> getKurtosisExcess() const
+    {
+        double n = static_cast<double>(getSize());
+        if (!getKurtosis().has_value() || (n - 2) * (n - 3) == 0)
+            return nullopt;
+        double adjustmentTerm = -3* (n - 1) * (n - 1) / ((n - 2) * (n - 3));
+        return getKurtosis().value() + adjustmentTerm;
+    }
+
+    // Preconditions: Instance holds more than 0 value.
+    // Postconditions: Return a vector of struct that contains value, frequency, and frequency percentage, read off
+    //                 the tree in order.
+    vector<FrequencyEntry> getFrequencyTable() const
+    {
+        auto frequencyTable = vector<FrequencyEntry>();
+        frequencyTable.reserve(getDistinctCount());
+        double totalFrequency = static_cast<double>(getSize());
+        tree.forEach([&frequencyTable, totalFrequency](const T& value, uint64_t count)
+        {
+            frequencyTable.push_back(FrequencyEntry{
+                .value = value,
+                .frequency = static_cast<long>(count),
+                .frequencyPercentage = count / totalFrequency
+            });
+        });
+        return frequencyTable;
+    }
+
+    // Preconditions: None
+    // Postconditions: Return the number of values strictly less than value.
+    size_t getRank(const T& value) const
+    {
+        return static_cast<size_t>(tree.countAndSumBelow(value).first);
+    }
+
+    // Preconditions: Instance holds more than 0 value.
+    // Postconditions: Return the percentage of values less than or equal to value.
+    double getPercentileRank(const T& value) const
+    {
+        return 100.0 * tree.countAndSumAtOrBelow(value).first / getSize();
+    }
+
+    // Preconditions: None
+    // Postconditions: Return the number of values in [low, high].
+    size_t getCountInRange(const T& low, const T& high) const
+    {
+        if (high < low)
+            return 0;
+        return static_cast<size_t>(tree.countAndSumAtOrBelow(high).first - tree.countAndSumBelow(low).first);
+    }
+
+    // Preconditions: None
+    // Postconditions: Return the sum of the values in [low, high].
+    double getSumInRange(const T& low, const T& high) const
+    {
+        if (high < low)
+            return 0.0;
+        return static_cast<double>(tree.countAndSumAtOrBelow(high).second - tree.countAndSumBelow(low).second);
+    }
+
+protected:
+    OrderStatisticTree<T> tree;
+    mutable Moments moments;
+    // Sum of the squared deviations from the mean that erase has taken out since the moments were last rebuilt.
+    mutable double erasedSquares = 0.0;
+    LoadReport _loadReport {};
+
+    mutable optional<Quartiles> _quartilesCache;
+
+    /// Helpers
+    // The mean written as shift + offset, compared against values without rounding them to double first.
+    struct ShiftedBound
+    {
+        T shift;
+        double offset;
+
+        friend bool operator<(const T& value, const ShiftedBound& bound)
+        {
+            return static_cast<double>(WideSumType<T>(value) - WideSumType<T>(bound.shift)) < bound.offset;
+        }
+    };
+
+    // Postconditions: Moments are recomputed from the values in O(distinct).
+    void rebuildMoments() const
+    {
+        moments = Moments();
+        erasedSquares = 0.0;
+        // count copies of one value have that value as mean and no deviation.
+        tree.forEach([this](const T& value, uint64_t count)
+        {
+            moments.merge(Moments::fromShiftedSums(count, static_cast<double>(value), 0, 0, 0, 0));
+        });
+    }
+
+    // Same definition as Statistics::getMedianInRange over the ranks [lowRank, highRank) of the sorted values.
+    optional<double> getMedianInRange(size_t lowRank, size_t highRank) const
+    {
+        return medianOfRankRange(lowRank, highRank, [this](uint64_t rank) { return tree.valueAtRank(rank); });
+    }
+};
+
+#endif //PROJ1_DYNAMICSTATISTICS_H
@@ -0,0 +1,448 @@
+// Name : Long Duong
+// Date: 10/17/2026
+// Description: A sibling of Statistics for files larger than memory, computed over an external merge sort.
+
+#ifndef PROJ1_EXTERNALSTATISTICS_H
+#define PROJ1_EXTERNALSTATISTICS_H
+
+#include <vector>
+#include <optional>
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <chrono>
+#include "statistics.h"
+#include "ui/UIExcept.h"
+#include "ui/configuration.h"
+#include "stats/numberParsing.h"
+#include "stats/ExternalSort.h"
+#include "stats/Moments.h"
+#include "stats/simdKernels.h"
+#include "stats/wideSum.h"
+#include "stats/quantiles.h"
+
+using namespace std;
+
+// Loading reads the file in chunks into an ExternalSort while count, sum and moments are accumulated. A single merge
+// pass over the sorted runs then finds min, max, the values at the quartile ranks, the absolute deviation sum, the
+// frequency runs, the mode and the upper outliers; the lower outliers, a prefix of the sorted order, are read back by
+// a second merge that stops at the lower fence. Every result is exact. The frequency table and the mode list are
+// kept while they fit the memory budget.
+template <typename T>
+class ExternalStatistics
+{
+public:
+    using Quartiles = typename Statistics<T>::Quartiles;
+    using FrequencyEntry = typename Statistics<T>::FrequencyEntry;
+    using LoadReport = typename Statistics<T>::LoadReport;
+
+    // Preconditions: None
+    // Postconditions: Instance keeps at most about memoryBudgetBytes of values in memory.
+    explicit ExternalStatistics(size_t memoryBudgetBytes = static_cast<size_t>(config::EXTERNAL_MEMORY_BUDGET_MB) << 20) :
+        memoryBudget {memoryBudgetBytes},
+        sorter {memoryBudgetBytes}
+    {}
+
+    // Preconditions: A path to a text file
+    // Postconditions: Every statistic of the file is computed, spilling sorted runs to temporary files when the
+    //                 values do not fit the memory budget. Throw exception if file cannot be opened.
+    void loadDataFromFilePath(string path)
+    {
+        ifstream statsFile(path, ios::in | ios::binary);
+        if (!statsFile.is_open())
+            throw UIExcept("Cannot open file");
+        clear();
+
+        auto parseStart = chrono::steady_clock::now();
+        size_t bytesRead = parseStreamInChunks<T>(statsFile, [this](const vector<T>& values)
+        {
+            for (const auto& value : values)
+            {
+                sorter.push(value);
+                moments.push(static_cast<double>(value));
+                sum.add(value);
+            }
+        });
+        sorter.finish();
+        chrono::duration<double> parseTime = chrono::steady_clock::now() - parseStart;
+        if (getSize() > 0)
+            mergePass();
+
+        _loadReport.bytesRead = bytesRead;
+        _loadReport.valuesParsed = getSize();
+        _loadReport.parseSeconds = parseTime.count();
+        _loadReport.valuesPerSecond = parseTime.count() > 0 ? getSize() / parseTime.count() : 0;
+    }
+
+    // Preconditions: loadDataFromFilePath was called.
+    // Postconditions: Return the size and parse throughput of the last load, the sort included.
+    const LoadReport& getLoadReport() const
+    {
+        return _loadReport;
+    }
+
+    // Preconditions: None
+    // Postconditions: Return how many sorted runs the last load spilled to disk, 0 if it fit in memory.
+    size_t getRunCount() const
+    {
+        return sorter.getRunCount();
+    }
+
+    // Preconditions: None
+    // Postconditions: Internal states and spill files are cleared to prepare for new data.
+    void clear()
+    {
+        sorter.clear();
+        moments = Moments();
+        sum = WideAccumulator<T>();
+        minMax.reset();
+        quartiles = Quartiles {};
+        absoluteDeviationSum = 0;
+        frequencyTable.clear();
+        frequencyTableComplete = true;
+        modes.clear();
+        outliers.clear();
+    }
+
+    // Preconditions: Instance was loaded with more than 0 value.
+    // Postconditions: Return the minimum
+    const T& getMin() const
+    {
+        return minMax->first;
+    }
+
+    // Preconditions: Instance was loaded with more than 0 value.
+    // Postconditions: Return maximum
+    const T& getMax() const
+    {
+        return minMax->second;
+    }
+
+    // Preconditions: Instance was loaded with more than 0 value.
+    // Postconditions: Return range
+    T getRange() const
+    {
+        return getMax() - getMin();
+    }
+
+    // Preconditions: Instance was loaded with more than 0 value.
+    // Postconditions: Return sum of all values, exact in 128 bits for integers.
+    WideSumType<T> getSum() const
+    {
+        return sum.value();
+    }
+
+    // Preconditions: None
+    // Postconditions: Return number of values.
+    size_t getSize() const
+    {
+        return static_cast<size_t>(sorter.size());
+    }
+
+    // Preconditions: Instance was loaded with more than 0 value.
+    // Postconditions: Return the mean of all values.
+    double getMean() const
+    {
+        return static_cast<double>(getSum()) / getSize();
+    }
+
+    // Preconditions: Instance was loaded with more than 0 value.
+    // Postconditions: Return an optional that contains the median if exist and nullopt otherwise.
+    optional<double> getMedian() const
+    {
+        return quartiles.Q2;
+    }
+
+    // Preconditions: Instance was loaded with more than 0 value.
+    // Postconditions: Return the mode. Only as many values as fit the memory budget are listed.
+    vector<T> getMode() const
+    {
+        return modes;
+    }
+
+    // Preconditions: Instance was loaded with more than 0 value.
+    // Postconditions: Return count, mean and central moment sums.
+    const Moments& getMoments() const
+    {
+        return moments;
+    }
+
+    // Preconditions: Instance was loaded with more than 0 value.
+    // Postconditions: Return the variance
+    double getVariance() const
+    {
+        return moments.getM2() / (getSize() - 1);
+    }
+
+    // Preconditions: Instance was loaded with more than 0 value.
+    // Postconditions: Return the standard deviation
+    double getStandardDeviation() const
+    {
+        return sqrt(getVariance());
+    }
+
+    // Preconditions: Instance was loaded with more than 0 value.
+    // Postconditions: Return the midRange
+    double getMidRange() const
+    {
+        return (getMax() + getMin()) / 2.0;
+    }
+
+    // Preconditions: Instance was loaded with more than 0 value.
+    // Postconditions: Return the quartiles with the median-of-halves definition of Statistics.
+    const Quartiles& getQuartiles() const
+    {
+        return quartiles;
+    }
+
+    // Preconditions: Instance was loaded with more than 0 value.
+    // Postconditions: Return the IQR if it exists, otherwise nullopt
+    optional<double> getIQR() const
+    {
+        if (!quartiles.Q3.has_value() || !quartiles.Q1.has_value())
+            return nullopt;
+        return quartiles.Q3.value() - quartiles.Q1.value();
+    }
+
+    // Preconditions: Instance was loaded with more than 0 value.
+    // Postconditions: Return outlierFence if IQR exists, nullopt otherwise.
+    optional<pair<double, double>> getOutlierFence() const
+    {
+        auto iqr = getIQR();
+        if (!iqr.has_value()) return nullopt;
+        return make_pair(quartiles.Q1.value() - 1.5 * iqr.value(), quartiles.Q3.value() + 1.5 * iqr.value());
+    }
+
+    // Preconditions: Instance was loaded with more than 0 value.
+    // Postconditions: Return the outliers in ascending order.
+    const vector<T>& getOutliers() const
+    {
+        return outliers;
+    }
+
+    // Preconditions: Instance was loaded with more than 0 value.
+    // Postconditions: Return sumOfSquares.
+    double getSumOfSquares() const
+    {
+        return moments.getM2();
+    }
+
+    // Preconditions: Instance was loaded with more than 0 value.
+    // Postconditions: Return mean absolute deviation.
+    double getMeanAbsoluteDeviation() const
+    {
+        return absoluteDeviationSum / getSize();
+    }
+
+    // Preconditions: Instance was loaded with more than 0 value.
+    // Postconditions: Return the root mean square
+    double getRootMeanSquare() const
+    {
+        return sqrt(moments.getMean() * moments.getMean() + moments.getM2() / getSize());
+    }
+
+    // Preconditions: Instance was loaded with more than 0 value.
+    // Postconditions: Return standard error of the mean
+    double getStdErrorOfMean() const
+    {
+        return getStandardDeviation() / sqrt(getSize());
+    }
+
+    // Preconditions: Instance was loaded with more than 0 value.
+    // Postconditions: Return coefficient of variantion
+    double getCoefficientOfVariation() const
+    {
+        return getStandardDeviation() / getMean();
+    }
+
+    // Preconditions: Instance was loaded with more than 0 value.
+    // Postconditions: Return relative standard deviation.
+    double getRelativeStd() const
+    {
+        return (100.0 * getStandardDeviation()) / getMean();
+    }
+
+    // Preconditions: Instance was loaded with more than 0 value.
+    // Postconditions: Return skewness
+    optional<double> getSkewness() const
+    {
+        double n = static_cast<double>(getSize());
+        if (n * pow(getStandardDeviation(), 3) == 0.0 || (n - 1)*(n - 2) == 0.0)
+            return nullopt;
+        double coefficient = n / ((n - 1) * (n - 2));
+        return coefficient * moments.getM3() / pow(getStandardDeviation(), 3);
+    }
+
+    // Preconditions: Instance was loaded with more than 0 value.
+    // Postconditions: Return kurtosis.
+    optional<double> getKurtosis() const
+    {
+        double n = static_cast<double>(getSize());
+        if (pow(getStandardDeviation(), 4) == 0.0 || (n - 1)*(n - 2)*(n - 3) == 0.0)
+            return nullopt;
+        double coefficient = n * (n + 1) / ((n - 1) * (n - 2) * (n - 3));
+        return coefficient * moments.getM4() / pow(getStandardDeviation(), 4);
+    }
+
+    // Preconditions: Instance was loaded with more than 0 value.
+    // Postconditions: Return kurtosis excess
+    optional<double> getKurtosisExcess() const
+    {
+        double n = static_cast<double>(getSize());
+        if (!getKurtosis().has_value() || (n - 2) * (n - 3) == 0)
+            return nullopt;
+        double adjustmentTerm = -3* (n - 1) * (n - 1) / ((n - 2) * (n - 3));
+        return getKurtosis().value() + adjustmentTerm;
+    }
+
+    // Preconditions: Instance was loaded with more than 0 value.
+    // Postconditions: Return a vector of struct that contains value, frequency, and frequency percentage. It is
+    //                 empty when isFrequencyTableComplete() is false.
+    const vector<FrequencyEntry>& getFrequencyTable() const
+    {
+        return frequencyTable;
+    }
+
+    // Preconditions: None
+    // Postconditions: Return false if the distinct values outgrew the memory budget and the table was dropped.
+    bool isFrequencyTableComplete() const
+    {
+        return frequencyTableComplete;
+    }
+
+protected:
+    size_t memoryBudget;
+    ExternalSort<T> sorter;
+    Moments moments;
+    WideAccumulator<T> sum;
+    LoadReport _loadReport {};
+
+    optional<pair<T, T>> minMax;
+    Quartiles quartiles {};
+    double absoluteDeviationSum = 0;
+    vector<FrequencyEntry> frequencyTable;
+    bool frequencyTableComplete = true;
+    vector<T> modes;
+    vector<T> outliers;
+
+    /// Helpers
+    // Preconditions: The sorter holds more than 0 value and moments are complete.
+    // Postconditions: Every order based statistic is filled from one merge, plus a partial merge for the lower
+    //                 outliers.
+    void mergePass()
+    {
+        uint64_t count = sorter.size();
+        uint64_t half = count / 2;
+        const pair<uint64_t, uint64_t> quartileRanges[] = {
+            {0, half}, {0, count}, {count % 2 == 0 ? half : half + 1, count}
+        };
+
+        // The ranks medianOfRankRange reads for the three quartiles, captured as the merge passes them.
+        vector<pair<uint64_t, T>> rankValues;
+        for (const auto& range : quartileRanges)
+            medianOfRankRange(range.first, range.second, [&rankValues](uint64_t rank)
+            {
+                rankValues.emplace_back(rank, T {});
+                return T {};
+            });
+        sort(rankValues.begin(), rankValues.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+        rankValues.erase(unique(rankValues.begin(), rankValues.end(),
+                                [](const auto& a, const auto& b) { return a.first == b.first; }),
+                         rankValues.end());
+        auto valueAtRank = [&rankValues](uint64_t rank)
+        {
+            return lower_bound(rankValues.begin(), rankValues.end(), rank,
+                               [](const auto& entry, uint64_t r) { return entry.first < r; })->second;
+        };
+        auto computeQuartiles = [&]()
+        {
+            quartiles = Quartiles {
+                .Q1 = medianOfRankRange(quartileRanges[0].first, quartileRanges[0].second, valueAtRank),
+                .Q2 = medianOfRankRange(quartileRanges[1].first, quartileRanges[1].second, valueAtRank),
+                .Q3 = medianOfRankRange(quartileRanges[2].first, quartileRanges[2].second, valueAtRank)
+            };
+        };
+        if (rankValues.empty())
+            computeQuartiles();
+
+        const size_t listLimit = max<size_t>(1, memoryBudget / 4 / sizeof(FrequencyEntry));
+        const double mean = moments.getMean();
+        const double totalFrequency = static_cast<double>(count);
+        optional<pair<double, double>> fence = getOutlierFence();
+        size_t nextRank = 0;
+        uint64_t rank = 0;
+        uint64_t runCount = 0, modeCount = 0;
+        T runValue {};
+
+        auto closeRun = [&]()
+        {
+            if (frequencyTableComplete)
+            {
+                if (frequencyTable.size() == listLimit)
+                {
+                    vector<FrequencyEntry>().swap(frequencyTable);
+                    frequencyTableComplete = false;
+                }
+                else
+                    frequencyTable.push_back(FrequencyEntry{
+                        .value = runValue,
+                        .frequency = static_cast<long>(runCount),
+                        .frequencyPercentage = runCount / totalFrequency
+                    });
+            }
+            if (runCount > modeCount)
+            {
+                modeCount = runCount;
+                modes.assign(1, runValue);
+            }
+            else if (runCount == modeCount && modes.size() < listLimit)
+                modes.push_back(runValue);
+        };
+
+        sorter.merge([&](const T& value)
+        {
+            if (rank == 0)
+                minMax.emplace(value, value);
+            else if (value != runValue)
+                closeRun();
+            if (rank == 0 || value != runValue)
+            {
+                runValue = value;
+                runCount = 0;
+            }
+            runCount++;
+            minMax->second = value;
+            absoluteDeviationSum += abs(value - mean);
+
+            if (nextRank < rankValues.size() && rankValues[nextRank].first == rank)
+            {
+                rankValues[nextRank++].second = value;
+                if (nextRank == rankValues.size())
+                {
+                    computeQuartiles();
+                    fence = getOutlierFence();
+                }
+            }
+            if (nextRank == rankValues.size() && fence.has_value() && value > fence->second)
+                outliers.push_back(value);
+            rank++;
+            return true;
+        });
+        closeRun();
+
+        if (fence.has_value())
+        {
+            vector<T> lowOutliers;
+            sorter.merge([&lowOutliers, &fence](const T& value)
+            {
+                if (!(value < fence->first))
+                    return false;
+                lowOutliers.push_back(value);
+                return true;
+            });
+            outliers.insert(outliers.begin(), lowOutliers.begin(), lowOutliers.end());
+        }
+    }
+};
+
+#endif //PROJ1_EXTERNALSTATISTICS_H
@@ -0,0 +1,107 @@
+// Name : Long Duong
+// Date: 10/17/2026
+// Description: Statistics over the last N values of a stream, reported after every value once the window is full.
+
+#ifndef PROJ1_SLIDINGWINDOWSTATISTICS_H
+#define PROJ1_SLIDINGWINDOWSTATISTICS_H
+
+#include <vector>
+#include <functional>
+#include "ui/UIExcept.h"
+#include "dynamicStatistics.h"
+
+using namespace std;
+
+// The window keeps its values twice: in arrival order in a ring buffer, to know which value leaves next, and in a
+// DynamicStatistics, which answers every getter. Each push is one insert and at most one erase, so mean and variance
+// update in O(1) and median, quartiles and outlier counts stay O(log N) per window.
+template <typename T>
+class SlidingWindowStatistics
+{
+public:
+    typedef function<void(const DynamicStatistics<T>&)> WindowCallback_t;
+
+    // Preconditions: windowSize > 0
+    // Postconditions: Instance is an empty window of windowSize values.
+    explicit SlidingWindowStatistics(size_t windowSize) :
+        capacity {windowSize},
+        oldest {0},
+        evictionsSinceRecompute {0}
+    {
+        if (windowSize == 0)
+            throw UIExcept("Window size must be positive");
+        ring.reserve(windowSize);
+    }
+
+    // Preconditions: None
+    // Postconditions: callback is called with the window statistics after every push that leaves the window full.
+    void setWindowCallback(WindowCallback_t callback)
+    {
+        onWindow = move(callback);
+    }
+
+    // Preconditions: None
+    // Postconditions: value enters the window and, once the window is full, the oldest value leaves it.
+    void push(const T& value)
+    {
+        if (ring.size() < capacity)
+            ring.push_back(value);
+        else
+        {
+            window.erase(ring[oldest]);
+            ring[oldest] = value;
+            oldest = (oldest + 1) % capacity;
+            // Every erase rounds the moments a little; recomputing once per window length keeps the error bounded
+            // at O(1) amortized cost per value.
+            if (++evictionsSinceRecompute == capacity)
+            {
+                window.recomputeMoments();
+                evictionsSinceRecompute = 0;
+            }
+        }
+        window.insert(value);
+        if (isFull() && onWindow)
+            onWindow(window);
+    }
+
+    // Preconditions: None
+    // Postconditions: Return whether the window holds getWindowSize() values.
+    bool isFull() const
+    {
+        return ring.size() == capacity;
+    }
+
+    // Preconditions: None
+    // Postconditions: Return the number of values the window holds when full.
+    size_t getWindowSize() const
+    {
+        return capacity;
+    }
+
+    // Preconditions: None
+    // Postconditions: Return the statistics of the values in the window, with the getters of Statistics.
+    const DynamicStatistics<T>& getWindow() const
+    {
+        return window;
+    }
+
+    // Preconditions: None
+    // Postconditions: The window is emptied; the window size and the callback are kept.
+    void clear()
+    {
+        ring.clear();
+        window.clear();
+        oldest = 0;
+        evictionsSinceRecompute = 0;
+    }
+
+private:
+    DynamicStatistics<T> window;
+    vector<T> ring;
+    size_t capacity;
+    size_t oldest;
+    size_t evictionsSinceRecompute;
+    WindowCallback_t onWindow;
+};
+
+#endif //PROJ1_SLIDINGWINDOWSTATISTICS_H
@@ -13,7 +13,22 @@
 #include <cmath>
 #include <functional>
 #include <fstream>
+#include <chrono>
+#include <memory>
+#include <filesystem>
+#include <span>
 #include "ui/Table.h"
+#include "ui/UIExcept.h"
+#include "stats/MappedFile.h"
+#include "stats/numberParsing.h"
+#include "stats/parallel.h"
+#include "stats/sorting.h"
+#include "stats/Moments.h"
+#include "stats/simdKernels.h"
+#include "stats/wideSum.h"
+#include "stats/PartialAggregate.h"
+#include "stats/CountTable.h"
+#include "stats/quantiles.h"
 
 using namespace std;
 
@@ -31,20 +46,307 @@ public:
         double frequencyPercentage;
     };
 
+    // One run of equal values in the sorted elements.
+    using RunEntry = struct {
+        T value;
+        size_t count;
+        size_t firstOffset;
+    };
+
+    // Read-only, indexable view of the values that reads run-length storage in place instead of expanding it.
+    // Reading the values in order moves from run to run in O(1); a jump costs a binary search.
+    class ElementView
+    {
+    public:
+        ElementView(span<const T> _values, span<const RunEntry> _runs, size_t _size) :
+            values {_values},
+            runs {_runs},
+            count {_size},
+            hint {0}
+        {}
+
+        size_t size() const
+        {
+            return count;
+        }
+
+        bool empty() const
+        {
+            return count == 0;
+        }
+
+        T operator[](size_t i) const
+        {
+            if (runs.empty())
+                return values[i];
+            if (i < runs[hint].firstOffset || i >= runs[hint].firstOffset + runs[hint].count)
+            {
+                if (hint + 1 < runs.size() && i >= runs[hint + 1].firstOffset
+                    && i < runs[hint + 1].firstOffset + runs[hint + 1].count)
+                    hint++;
+                else
+                    hint = static_cast<size_t>(std::distance(runs.begin(), upper_bound(
+                        runs.begin(), runs.end(), i,
+                        [](size_t offset, const RunEntry& run) { return offset < run.firstOffset; }))) - 1;
+            }
+            return runs[hint].value;
+        }
+
+    private:
+        span<const T> values;
+        span<const RunEntry> runs;
+        size_t count;
+        mutable size_t hint;
+    };
+
+    // Prefix sums over the sorted elements: prefixSums[i] is the sum of the first i elements and
+    // prefixSquares[i] the sum of their squared deviations from pivot, the overall mean.
+    using RangeIndex = struct {
+        double pivot;
+        vector<WideSumType<T>> prefixSums;
+        vector<double> prefixSquares;
+    };
+
+    // Views into the sorted elements below the lower fence and above the upper fence. They stay valid until the
+    // elements change.
+    using OutlierSpans = struct {
+        span<const T> low;
+        span<const T> high;
+    };
+
+    using LoadReport = struct {
+        size_t bytesRead;
+        size_t valuesParsed;
+        double parseSeconds;
+        double valuesPerSecond;
+    };
+
+    // Stream reads through ifstream >> T, MemoryMapped parses the mapped file with from_chars and
+    // ParallelMapped splits the mapping into whitespace aligned chunks parsed on worker threads.
+    // All of them produce the same elements.
+    enum class LoadMode { Stream, MemoryMapped, ParallelMapped };
+
+    // SortOnLoad sorts right after loading. SortOnDemand leaves elements unsorted: min, max, sum, moments,
+    // mode and frequencies are computed without sorting (frequencies through a hash table) and the sort only
+    // runs once an order statistic is requested. NoSort goes further and finds the median and quartiles by
+    // selection in expected O(n); only outliers and the run index still sort. Both build the moments and the
+    // absolute deviation sum before the first sort or selection reorders the elements, so those do not depend on
+    // the order of the getter calls. After append() the absolute deviation sum is recomputed over the current order.
+    enum class OrderPolicy { SortOnLoad, SortOnDemand, NoSort };
+
+    // Elements keeps every value. RunLength keeps only the sorted (value, count) runs of the run index, so memory and
+    // the getters scale with the number of distinct values; the few calls that need the values themselves expand
+    // them back. Auto switches to RunLength after a sorted load when the distinct values are at most
+    // config::RUN_LENGTH_DISTINCT_RATIO of the size.
+    enum class StorageMode { Elements, RunLength, Auto };
+
     // Preconditions: A path to a text file
     // Postconditions: Initialized the instance with data from text file or throw exception if file cannot be opened.
     void loadDataFromFilePath(string path)
     {
-        ifstream statsFile(path, ios::in);
-        if (statsFile.is_open())
+        auto parseStart = chrono::steady_clock::now();
+        size_t bytesRead = 0;
+        if (loadMode == LoadMode::MemoryMapped)
+            bytesRead = loadMappedFile(path);
+        else if (loadMode == LoadMode::ParallelMapped)
+            bytesRead = loadMappedFileInParallel(path);
+        else
+            bytesRead = loadStreamFile(path);
+        chrono::duration<double> parseTime = chrono::steady_clock::now() - parseStart;
+
+        sorted = false;
+        if (orderPolicy == OrderPolicy::SortOnLoad)
+            ensureSorted();
+
+        _loadReport.bytesRead = bytesRead;
+        _loadReport.valuesParsed = elements.size();
+        _loadReport.parseSeconds = parseTime.count();
+        _loadReport.valuesPerSecond = parseTime.count() > 0 ? elements.size() / parseTime.count() : 0;
+        applyStorageMode();
+    }
+
+    // Preconditions: None
+    // Postconditions: Subsequent loads use the given mode.
+    void setLoadMode(LoadMode mode)
+    {
+        loadMode = mode;
+    }
+
+    // Preconditions: None
+    // Postconditions: Return the mode used by loadDataFromFilePath.
+    LoadMode getLoadMode() const
+    {
+        return loadMode;
+    }
+
+    // Preconditions: None
+    // Postconditions: Subsequent loads and constructions sort with the given algorithm.
+    void setSortAlgorithm(SortAlgorithm algorithm)
+    {
+        sortAlgorithm = algorithm;
+    }
+
+    // Preconditions: None
+    // Postconditions: Return the algorithm used by the sort stage.
+    SortAlgorithm getSortAlgorithm() const
+    {
+        return sortAlgorithm;
+    }
+
+    // Preconditions: None
+    // Postconditions: Subsequent loads follow the given policy.
+    void setOrderPolicy(OrderPolicy policy)
+    {
+        orderPolicy = policy;
+    }
+
+    // Preconditions: None
+    // Postconditions: Return when loadDataFromFilePath sorts the elements.
+    OrderPolicy getOrderPolicy() const
+    {
+        return orderPolicy;
+    }
+
+    // Preconditions: None
+    // Postconditions: Subsequent loads store the values in the given mode.
+    void setStorageMode(StorageMode mode)
+    {
+        storageMode = mode;
+    }
+
+    // Preconditions: None
+    // Postconditions: Return how loadDataFromFilePath stores the values.
+    StorageMode getStorageMode() const
+    {
+        return storageMode;
+    }
+
+    // Preconditions: None
+    // Postconditions: Return whether the values are currently held as runs only.
+    bool isRunLength() const
+    {
+        return runLength;
+    }
+
+    // Preconditions: None
+    // Postconditions: Return a copy of the values, sorted unless the OrderPolicy left them unsorted. Run-length
+    //                 storage is expanded into the copy only.
+    vector<T> getElements() const
+    {
+        if (!runLength)
+            return elements;
+        vector<T> values(runLengthSize);
+        const auto& runs = getRunIndex();
+        parallelFor(runs.size(), [&](size_t run)
+        {
+            fill_n(values.begin() + runs[run].firstOffset, runs[run].count, runs[run].value);
+        });
+        return values;
+    }
+
+    // Preconditions: None
+    // Postconditions: elements are sorted. Does nothing if they already are.
+    void ensureSorted() const
+    {
+        if (sorted)
+            return;
+        if (orderPolicy != OrderPolicy::SortOnLoad)
+            cacheOrderSensitiveSums();
+        sortValues(elements, sortAlgorithm);
+        sorted = true;
+    }
+
+    // Preconditions: loadDataFromFilePath was called.
+    // Postconditions: Return the size and parse throughput of the last load.
+    const LoadReport& getLoadReport() const
+    {
+        return _loadReport;
+    }
+
+    // Preconditions: None
+    // Postconditions: Return a view of the values, sorted unless the OrderPolicy left them unsorted, valid until they
+    //                 change. Run-length storage is expanded first since the view points into the values.
+    span<const T> getElementSpan() const
+    {
+        expandRuns();
+        return span<const T>(elements);
+    }
+
+    // Preconditions: None
+    // Postconditions: Return a view of the values like getElementSpan, valid until they change, that leaves
+    //                 run-length storage in place.
+    ElementView getElementView() const
+    {
+        if (!runLength)
+            return ElementView(span<const T>(elements), span<const RunEntry>(), elements.size());
+        return ElementView(span<const T>(), span<const RunEntry>(getRunIndex()), runLengthSize);
+    }
+
+    // Preconditions: None
+    // Postconditions: Return a mergeable summary of the elements, e.g. to combine this shard with others.
+    PartialAggregate<T> getPartialAggregate() const
+    {
+        if (runLength)
+        {
+            auto values = getElements();
+            return PartialAggregate<T>::fromValues(values.data(), values.size());
+        }
+        return PartialAggregate<T>::fromValues(elements.data(), elements.size());
+    }
+
+    // Preconditions: batch is a range of values convertible to T.
+    // Postconditions: The values are added to elements. Only the batch is sorted, then merged into the sorted
+    //                 elements in linear time. Sum, min/max and moment caches are updated from the batch alone;
+    //                 order based caches are dropped and rebuilt when next asked for. Under run-length storage
+    //                 the sorted batch is merged into the runs instead, so the storage stays run-length.
+    template <typename Range>
+    void append(const Range& batch)
+    {
+        vector<T> values(std::begin(batch), std::end(batch));
+        if (values.empty())
+            return;
+
+        if (_sumCache.has_value())
+        {
+            _sumCache.emplace(_sumCache.value() + wideSum(values.data(), values.size()));
+        }
+        if (_momentsCache.has_value())
+            _momentsCache->merge(momentsOf(values.data(), values.size()));
+        if (_minMaxCache.has_value())
+        {
+            auto batchMinMax = kernelMinMax(values.data(), values.size());
+            _minMaxCache.emplace(min(_minMaxCache->first, batchMinMax.first),
+                                 max(_minMaxCache->second, batchMinMax.second));
+        }
+
+        if (runLength)
+        {
+            sortValues(values, sortAlgorithm);
+            mergeIntoRuns(values);
+        }
+        else if (sorted)
         {
-            clear();
-            T currentValue;
-            while (statsFile >> currentValue)
-                elements.push_back(currentValue);
-            sort(elements.begin(), elements.end());
+            sortValues(values, sortAlgorithm);
+            vector<T> merged(elements.size() + values.size());
+            parallelMerge(elements.data(), elements.data() + elements.size(),
+                          values.data(), values.data() + values.size(), merged.data(), workerThreadCount());
+            elements.swap(merged);
         }
-        else throw UIExcept("Cannot open file");
+        else
+            elements.insert(elements.end(), values.cbegin(), values.cend());
+
+        _meanCache.reset();
+        _varianceCache.reset();
+        if (_sumCache.has_value())
+            _meanCache.emplace(static_cast<double>(_sumCache.value()) / getSize());
+        if (_momentsCache.has_value() && getSize() > 1)
+            _varianceCache.emplace(_momentsCache->getM2() / (getSize() - 1));
+        _absoluteDeviationCache.reset();
+        _quartilesCache.reset();
+        if (!runLength)
+            _runIndexCache.reset();
+        _frequencyTableCache.reset();
+        _rangeIndexCache.reset();
     }
 
     // Preconditions: None
@@ -52,36 +354,50 @@ public:
     void clear()
     {
         elements.clear();
+        sorted = true;
+        runLength = false;
+        runLengthSize = 0;
+        _minMaxCache.reset();
         _meanCache.reset();
         _sumCache.reset();
         _varianceCache.reset();
         _quartilesCache.reset();
+        _momentsCache.reset();
+        _absoluteDeviationCache.reset();
+        _runIndexCache.reset();
+        _frequencyTableCache.reset();
+        _rangeIndexCache.reset();
     }
 
     Statistics() :
         elements {}
     {}
 
-    // Preconditions: Expect a vector of elements T
+    // Preconditions: Expect a vector of elements T and optionally the sort algorithm to use
     // Postconditions: Instance initialized  with data in T
-    Statistics(vector<T>&& elements) :
-        elements {move(elements)}
+    Statistics(vector<T>&& _elements, SortAlgorithm algorithm = SortAlgorithm::Standard) :
+        elements {move(_elements)},
+        sortAlgorithm {algorithm}
     {
-        sort(elements.begin(), elements.end());
+        sortValues(elements, sortAlgorithm);
     }
 
     // Preconditions: Instance was initialized with more than 0 element.
     // Postconditions: Return the minimum
     const T& getMin() const
     {
-        return elements.front();
+        if (runLength)
+            return getRunIndex().front().value;
+        return sorted ? elements.front() : getMinMax().first;
     }
 
     // Preconditions: Instance was initialized with more than 0 element.
     // Postconditions: Return maximum
     const T& getMax() const
     {
-        return elements.back();
+        if (runLength)
+            return getRunIndex().back().value;
+        return sorted ? elements.back() : getMinMax().second;
     }
     
     // Preconditions: Instance was initialized with more than 0 element.
@@ -92,14 +408,23 @@ public:
     }
     
     // Preconditions: Instance was initialized with more than 0 element.
-    // Postconditions: Return sum of all elements.
-    const T& getSum() const
+    // Postconditions: Return sum of all elements, exact in 128 bits for integers and compensated for floating
+    //                 values, see wideSum.
+    const WideSumType<T>& getSum() const
     {
         if (_sumCache.has_value())
             return _sumCache.value();
+        else if (runLength)
+        {
+            WideAccumulator<T> sum;
+            for (const auto& run : getRunIndex())
+                sum.addRepeated(run.value, run.count);
+            _sumCache.emplace(sum.value());
+            return _sumCache.value();
+        }
         else
         {
-            _sumCache.emplace(accumulate(elements.cbegin(), elements.cend(), 0, plus<>()));
+            _sumCache.emplace(wideSum(elements.data(), elements.size()));
             return _sumCache.value();
         }
     }
@@ -108,7 +433,7 @@ public:
     // Postconditions: Return number of elements.
     size_t getSize() const
     {
-        return elements.size();
+        return runLength ? runLengthSize : elements.size();
     }
     
     // Preconditions: Instance was initialized with more than 0 element.
@@ -128,6 +453,11 @@ public:
     // Postconditions: Return an optional that contains the median if exist and nullopt otherwise.
     optional<double> getMedian() const
     {
+        if (!sorted && orderPolicy == OrderPolicy::NoSort)
+            return getQuartiles().Q2;
+        ensureSorted();
+        if (runLength)
+            return medianOfRankRange(0, getSize(), [this](size_t rank) { return runValueAt(rank); });
         return getMedianInRange(elements.begin(), elements.end());
     }
 
@@ -135,7 +465,7 @@ public:
     // Postconditions: Return the mode.
     vector<T> getMode() const
     {
-        auto freqTable = getFrequencyTable();
+        const auto& freqTable = getFrequencyTable();
         auto maxEntry = max_element(freqTable.cbegin(), freqTable.cend(),
                                          [](const FrequencyEntry& entry1, const  FrequencyEntry& entry2)
                                          {
@@ -150,6 +480,89 @@ public:
         return modeElements;
     }
 
+    // Preconditions: None
+    // Postconditions: Return the number of distinct elements.
+    size_t getDistinctCount() const
+    {
+        return sorted ? getRunIndex().size() : getFrequencyTable().size();
+    }
+
+    // Preconditions: None
+    // Postconditions: Return the run of value in the sorted elements, or nullopt if value does not occur.
+    optional<RunEntry> findRun(const T& value) const
+    {
+        const auto& runs = getRunIndex();
+        auto run = lower_bound(runs.cbegin(), runs.cend(), value,
+                               [](const RunEntry& entry, const T& v) { return entry.value < v; });
+        if (run == runs.cend() || run->value != value)
+            return nullopt;
+        return *run;
+    }
+
+    // Preconditions: None
+    // Postconditions: Return how many times value occurs.
+    size_t getFrequency(const T& value) const
+    {
+        auto run = findRun(value);
+        return run.has_value() ? run->count : 0;
+    }
+
+    // Preconditions: Instance was initialized with more than 0 element.
+    // Postconditions: Return count, mean and central moment sums, computed in one fused pass over the data and
+    //                 cached. append() updates the cache instead of dropping it.
+    const Moments& getMoments() const
+    {
+        if (!_momentsCache.has_value())
+            _momentsCache.emplace(runLength ? momentsOfRuns(getRunIndex())
+                                            : momentsOf(elements.data(), elements.size()));
+        return _momentsCache.value();
+    }
+
+    // Preconditions: Instance was initialized with more than 0 element.
+    // Postconditions: Return the sum of |x - mean| over the elements, cached.
+    double getAbsoluteDeviationSum() const
+    {
+        if (_absoluteDeviationCache.has_value())
+            return _absoluteDeviationCache.value();
+
+        // On sorted data sum |x - mean| = 2 * sum over x > mean of (x - mean), so only the smaller side of the mean
+        // has to be revisited. Unsorted data is walked in full.
+        double mean = getMoments().getMean();
+        if (runLength)
+        {
+            double deviationSum = 0.0;
+            for (const auto& run : getRunIndex())
+                deviationSum += run.count * abs(run.value - mean);
+            _absoluteDeviationCache.emplace(deviationSum);
+            return _absoluteDeviationCache.value();
+        }
+        size_t sideStart = 0, sideLength = elements.size();
+        double sideFactor = 1.0;
+        if (sorted)
+        {
+            size_t split = std::distance(elements.cbegin(),
+                                         upper_bound(elements.cbegin(), elements.cend(), mean,
+                                                     [](double value, const T& element) { return value < element; }));
+            bool upperSideSmaller = split >= elements.size() - split;
+            sideStart = upperSideSmaller ? split : 0;
+            sideLength = upperSideSmaller ? elements.size() - split : split;
+            sideFactor = 2.0;
+        }
+        double sideSum = parallelReduce(
+            sideLength, 0.0,
+            [this, sideStart, mean](size_t first, size_t last)
+            {
+                double partial = 0.0;
+                for (size_t i = sideStart + first; i < sideStart + last; i++)
+                    partial += abs(elements[i] - mean);
+                return partial;
+            },
+            plus<>()
+        );
+        _absoluteDeviationCache.emplace(sideFactor * sideSum);
+        return _absoluteDeviationCache.value();
+    }
+
     // Preconditions: Instance was initialized with more than 0 element.
     // Postconditions: Return the variance
     const double& getVariance() const
@@ -158,14 +571,7 @@ public:
             return _varianceCache.value();
         else
         {
-            _varianceCache.emplace(
-                transform_reduce(
-                    elements.cbegin(), elements.cend(),
-                    0.0,
-                    plus<>(),
-                    [this](const T& element) { return pow(element - this->getMean(), 2); }
-                ) / (getSize() - 1)
-            );
+            _varianceCache.emplace(getMoments().getM2() / (getSize() - 1));
             return _varianceCache.value();
         }
     }
@@ -192,7 +598,22 @@ public:
             return _quartilesCache.value();
         else
         {
-            if (getSize() % 2 == 0)
+            if (!sorted && orderPolicy == OrderPolicy::NoSort)
+                selectQuartileRanks();
+            else
+                ensureSorted();
+            if (runLength)
+            {
+                size_t n = getSize();
+                auto valueAtRank = [this](size_t rank) { return runValueAt(rank); };
+                _quartilesCache.emplace(
+                    Quartiles {
+                        .Q1 = medianOfRankRange(0, n / 2, valueAtRank),
+                        .Q2 = medianOfRankRange(0, n, valueAtRank),
+                        .Q3 = medianOfRankRange(n % 2 == 0 ? n / 2 : n / 2 + 1, n, valueAtRank)
+                    });
+            }
+            else if (getSize() % 2 == 0)
             {
                 _quartilesCache.emplace(
                     Quartiles {
@@ -228,23 +649,66 @@ public:
     // Postconditions: Return outlierFence if IQR exists, nullopt otherwise.
     optional<pair<double, double>> getOutlierFence() const
     {
-        if (!getIQR().has_value()) return nullopt;
+        auto iqr = getIQR();
+        if (!iqr.has_value()) return nullopt;
         const auto& q = getQuartiles();
-        return make_pair(q.Q1.value() - 1.5 * getIQR().value(), q.Q3.value() + 1.5 * getIQR().value());
+        return make_pair(q.Q1.value() - 1.5 * iqr.value(), q.Q3.value() + 1.5 * iqr.value());
+    }
+
+    // Preconditions: Instance was initialized with more than 0 element.
+    // Postconditions: Return zero-copy views of the outliers. On sorted data they are a prefix and a suffix whose
+    //                 bounds are found by binary search. Run-length storage is expanded first since the views point
+    //                 into the values.
+    OutlierSpans getOutlierSpans() const
+    {
+        auto fence = getOutlierFence();
+        if (!fence.has_value())
+            return OutlierSpans {};
+        expandRuns();
+        ensureSorted();
+        auto lowEnd = lower_bound(elements.cbegin(), elements.cend(), fence->first,
+                                  [](const T& element, double value) { return element < value; });
+        auto highBegin = upper_bound(lowEnd, elements.cend(), fence->second,
+                                     [](double value, const T& element) { return value < element; });
+        return OutlierSpans {
+            .low = span<const T>(elements.data(), static_cast<size_t>(std::distance(elements.cbegin(), lowEnd))),
+            .high = span<const T>(elements.data() + std::distance(elements.cbegin(), highBegin),
+                                  static_cast<size_t>(std::distance(highBegin, elements.cend())))
+        };
+    }
+
+    // Preconditions: Instance was initialized with more than 0 element.
+    // Postconditions: Return the number of outliers in O(log n) once sorted.
+    size_t getOutlierCount() const
+    {
+        if (runLength)
+        {
+            auto [lowEnd, highBegin] = getOutlierRuns();
+            return runOffsetAt(lowEnd) + (getSize() - runOffsetAt(highBegin));
+        }
+        auto spans = getOutlierSpans();
+        return spans.low.size() + spans.high.size();
     }
 
     // Preconditions: Instance was initialized with more than 0 element.
     // Postconditions: Return an array of outliers. 
     vector<T> getOutliers() const
     {
-        auto outliers = vector<T>();
-        if (!getOutlierFence().has_value()) return outliers;
-        auto fence = getOutlierFence().value();
-        copy_if(
-            elements.cbegin(), elements.cend(),
-            back_inserter(outliers),
-            [&fence](const auto& e){ return e < fence.first || e > fence.second; }
-        );
+        if (runLength)
+        {
+            auto [lowEnd, highBegin] = getOutlierRuns();
+            const auto& runs = getRunIndex();
+            auto outliers = vector<T>();
+            outliers.reserve(getOutlierCount());
+            for (auto run = runs.cbegin(); run != lowEnd; ++run)
+                outliers.insert(outliers.end(), run->count, run->value);
+            for (auto run = highBegin; run != runs.cend(); ++run)
+                outliers.insert(outliers.end(), run->count, run->value);
+            return outliers;
+        }
+        auto spans = getOutlierSpans();
+        auto outliers = vector<T>(spans.low.begin(), spans.low.end());
+        outliers.insert(outliers.end(), spans.high.begin(), spans.high.end());
         return outliers;
     }
 
@@ -252,41 +716,22 @@ public:
     // Postconditions: Return sumOfSquares.
     double getSumOfSquares() const
     {
-        return
-        transform_reduce(
-            elements.cbegin(), elements.cend(),
-            0.0,
-            plus<>(),
-            [this](const T& element) { return pow(element - this->getMean(), 2);}
-        );
+        return getMoments().getM2();
     }
     
     // Preconditions: Instance was initialized with more than 0 element.
     // Postconditions: Return mean absolute deviation.
     double getMeanAbsoluteDeviation() const
     {
-        return
-            transform_reduce(
-                elements.cbegin(), elements.cend(),
-                0.0,
-                plus<>(),
-                [this](const T& element) { return abs(element - this->getMean()); }
-        ) / getSize();
+        return getAbsoluteDeviationSum() / getSize();
     }
     
     // Preconditions: Instance was initialized with more than 0 element.
     // Postconditions: Return the root mean square
     double getRootMeanSquare() const
     {
-        return
-        sqrt(
-            transform_reduce(
-                elements.cbegin(), elements.cend(),
-                0.0,
-                plus<>(),
-                [](const T& element) { return element * element; }
-            ) / getSize()
-        );
+        const auto& moments = getMoments();
+        return sqrt(moments.getMean() * moments.getMean() + moments.getM2() / getSize());
     }
 
     // Preconditions: Instance was initialized with more than 0 element.
@@ -318,16 +763,7 @@ public:
         if (n * pow(getStandardDeviation(), 3) == 0.0 || (n - 1)*(n - 2) == 0.0)
             return nullopt;
         double coefficient = static_cast<double>(n) / ((n - 1) * (n - 2));
-        return
-        coefficient * transform_reduce(
-            elements.cbegin(), elements.cend(),
-            0.0,
-            plus<>(),
-            [this](const double& e)
-            {
-                return pow((e - this->getMean())/(getStandardDeviation()), 3);
-            }
-        );
+        return coefficient * getMoments().getM3() / pow(getStandardDeviation(), 3);
     }
     
     // Preconditions: Instance was initialized with more than 0 element.
@@ -338,13 +774,7 @@ public:
         if (pow(getStandardDeviation(), 4) == 0.0 || (n - 1)*(n - 2)*(n - 3) == 0.0)
             return nullopt;
         double coefficient = n * (n + 1) / ((n - 1) * (n - 2) * (n - 3));
-        return
-        coefficient * transform_reduce(
-            elements.cbegin(), elements.cend(),
-            0.0,
-            plus<>(),
-            [this](const auto& e){ return pow(e - this->getMean(), 4); }
-        ) / pow(getStandardDeviation(), 4);
+        return coefficient * getMoments().getM4() / pow(getStandardDeviation(), 4);
     }
     
     // Preconditions: Instance was initialized with more than 0 element.
@@ -360,52 +790,621 @@ public:
     
     // Preconditions: Instance was initialized with more than 0 element.
     // Postconditions: Return a vector of struct that contains value, frequency, and frequency percentage.
-    vector<FrequencyEntry> getFrequencyTable() const
+    //                 Built once, from the run index when sorted and from a hash count otherwise, and cached.
+    const vector<FrequencyEntry>& getFrequencyTable() const
     {
-        auto frequencyTable = vector<FrequencyEntry> ();
-        auto it = elements.cbegin();
-        for (; it != elements.cend(); it++)
+        if (_frequencyTableCache.has_value())
+            return _frequencyTableCache.value();
+
+        double totalFrequency = static_cast<double>(getSize());
+        auto frequencyTable = vector<FrequencyEntry>();
+        if (sorted)
+        {
+            const auto& runs = getRunIndex();
+            frequencyTable.resize(runs.size());
+            transform(runs.cbegin(), runs.cend(), frequencyTable.begin(), [totalFrequency](const RunEntry& run)
+            {
+                return FrequencyEntry{
+                    .value = run.value,
+                    .frequency = static_cast<long>(run.count),
+                    .frequencyPercentage = run.count / totalFrequency
+                };
+            });
+        }
+        else
         {
-            auto newEntry = FrequencyEntry{
-                .value = *it,
-                .frequency = 1,
-                .frequencyPercentage = -1
-            };
+            auto counts = CountTable<T>::fromValues(elements.data(), elements.size()).sortedEntries();
+            frequencyTable.resize(counts.size());
+            transform(counts.cbegin(), counts.cend(), frequencyTable.begin(), [totalFrequency](const auto& count)
+            {
+                return FrequencyEntry{
+                    .value = count.first,
+                    .frequency = static_cast<long>(count.second),
+                    .frequencyPercentage = count.second / totalFrequency
+                };
+            });
+        }
+        _frequencyTableCache.emplace(move(frequencyTable));
+        return _frequencyTableCache.value();
+    }
 
-            if (std::next(it) != elements.cend())
+    // Preconditions: None
+    // Postconditions: Return the runs of equal values in ascending order, built once after the sort and cached
+    //                 until clear(). Sorts the elements first if they are not yet.
+    const vector<RunEntry>& getRunIndex() const
+    {
+        if (_runIndexCache.has_value())
+            return _runIndexCache.value();
+        ensureSorted();
+
+        // Slices start on the first element of a run so that no run is split between two workers.
+        size_t sliceSize = config::REDUCTION_BLOCK_SIZE;
+        vector<size_t> sliceStarts {0};
+        for (size_t start = sliceSize; start < elements.size(); start += sliceSize)
+        {
+            if (start <= sliceStarts.back())
+                continue;
+            size_t runStart = std::distance(elements.cbegin(),
+                                            findRunEnd(elements.cbegin() + start - 1, elements.cend()));
+            if (runStart < elements.size() && runStart > sliceStarts.back())
+                sliceStarts.push_back(runStart);
+        }
+        sliceStarts.push_back(elements.size());
+
+        vector<vector<RunEntry>> sliceRuns(sliceStarts.size() - 1);
+        parallelFor(sliceRuns.size(), [&](size_t slice)
+        {
+            auto it = elements.cbegin() + sliceStarts[slice];
+            auto sliceEnd = elements.cbegin() + sliceStarts[slice + 1];
+            while (it != sliceEnd)
             {
-                while (std::next(it) != elements.cend() && *std::next(it) == newEntry.value)
-                {
-                    newEntry.frequency++;
-                    it++;
-                }
+                auto runEnd = findRunEnd(it, sliceEnd);
+                sliceRuns[slice].push_back(RunEntry{
+                    .value = *it,
+                    .count = static_cast<size_t>(std::distance(it, runEnd)),
+                    .firstOffset = static_cast<size_t>(std::distance(elements.cbegin(), it))
+                });
+                it = runEnd;
             }
-            frequencyTable.push_back(newEntry);
+        });
+
+        auto runs = vector<RunEntry>();
+        for (const auto& slice : sliceRuns)
+            runs.insert(runs.end(), slice.cbegin(), slice.cend());
+        _runIndexCache.emplace(move(runs));
+        return _runIndexCache.value();
+    }
+
+    // Preconditions: Instance was initialized with more than 0 element and 0 <= percent <= 100.
+    // Postconditions: Return the percent-th percentile under the given quantile definition, in O(1) once sorted.
+    double getPercentile(double percent, QuantileMethod method = QuantileMethod::Type7) const
+    {
+        ensureSorted();
+        if (runLength)
+            return rankQuantile(getSize(), percent / 100.0, method, [this](size_t rank) { return runValueAt(rank); });
+        return sortedQuantile(elements.data(), elements.size(), percent / 100.0, method);
+    }
+
+    // Preconditions: None
+    // Postconditions: Return the number of elements strictly less than value.
+    size_t getRank(const T& value) const
+    {
+        ensureSorted();
+        if (runLength)
+            return runOffsetAt(lowerBoundRun(value));
+        return std::distance(elements.cbegin(), lower_bound(elements.cbegin(), elements.cend(), value));
+    }
+
+    // Preconditions: Instance was initialized with more than 0 element.
+    // Postconditions: Return the percentage of elements less than or equal to value.
+    double getPercentileRank(const T& value) const
+    {
+        ensureSorted();
+        if (runLength)
+            return 100.0 * runOffsetAt(upperBoundRun(value)) / getSize();
+        auto atOrBelow = std::distance(elements.cbegin(), upper_bound(elements.cbegin(), elements.cend(), value));
+        return 100.0 * atOrBelow / getSize();
+    }
+
+    // Preconditions: None
+    // Postconditions: Return the number of elements in [low, high].
+    size_t getCountInRange(const T& low, const T& high) const
+    {
+        auto [first, last] = getIndexRange(low, high);
+        return last - first;
+    }
+
+    // Preconditions: None
+    // Postconditions: Return the sum of the elements in [low, high].
+    double getSumInRange(const T& low, const T& high) const
+    {
+        if (runLength)
+        {
+            WideAccumulator<T> sum;
+            visitRunsInRange(low, high, [&sum](const RunEntry& run) { sum.addRepeated(run.value, run.count); });
+            return static_cast<double>(sum.value());
         }
+        auto [first, last] = getIndexRange(low, high);
+        const auto& prefixSums = getRangeIndex().prefixSums;
+        return static_cast<double>(prefixSums[last] - prefixSums[first]);
+    }
 
-        long totalFrequency = transform_reduce(
-            frequencyTable.cbegin(), frequencyTable.cend(),
-            0,
-            plus<>(),
-            [](const FrequencyEntry& entry) { return entry.frequency; }
-        );
-        for (auto& entry: frequencyTable)
+    // Preconditions: None
+    // Postconditions: Return the mean of the elements in [low, high], nullopt if there is none.
+    optional<double> getMeanInRange(const T& low, const T& high) const
+    {
+        auto [first, last] = getIndexRange(low, high);
+        if (last == first)
+            return nullopt;
+        return getSumInRange(low, high) / (last - first);
+    }
+
+    // Preconditions: None
+    // Postconditions: Return the sample variance of the elements in [low, high], nullopt if there are fewer than 2.
+    optional<double> getVarianceInRange(const T& low, const T& high) const
+    {
+        auto [first, last] = getIndexRange(low, high);
+        if (last - first < 2)
+            return nullopt;
+        if (runLength)
         {
-            entry.frequencyPercentage = static_cast<double>(entry.frequency) / totalFrequency;
+            Moments moments;
+            visitRunsInRange(low, high, [&moments](const RunEntry& run)
+            {
+                moments.merge(Moments::fromShiftedSums(run.count, static_cast<double>(run.value), 0, 0, 0, 0));
+            });
+            return moments.getM2() / (last - first - 1);
         }
-        return frequencyTable;
+        const auto& index = getRangeIndex();
+        double count = static_cast<double>(last - first);
+        double meanShift = static_cast<double>(index.prefixSums[last] - index.prefixSums[first]) / count - index.pivot;
+        double squares = index.prefixSquares[last] - index.prefixSquares[first];
+        return max(0.0, squares - count * meanShift * meanShift) / (count - 1);
+    }
+
+    // Preconditions: None
+    // Postconditions: Return the prefix sum arrays over the sorted elements, built once in parallel and cached
+    //                 until clear(). Run-length storage is expanded first.
+    const RangeIndex& getRangeIndex() const
+    {
+        if (_rangeIndexCache.has_value())
+            return _rangeIndexCache.value();
+
+        expandRuns();
+        ensureSorted();
+        size_t n = elements.size();
+        double pivot = n > 0 ? getMean() : 0.0;
+        vector<WideSumType<T>> prefixSums(n + 1, WideSumType<T>(0));
+        vector<double> prefixSquares(n + 1, 0.0);
+
+        // Each block writes its local prefix sums, then adds the total of every block before it.
+        size_t blockSize = config::REDUCTION_BLOCK_SIZE;
+        size_t blockCount = (n + blockSize - 1) / blockSize;
+        parallelFor(blockCount, [&](size_t block)
+        {
+            WideSumType<T> sum = 0;
+            double squares = 0.0;
+            for (size_t i = block * blockSize; i < min(n, (block + 1) * blockSize); i++)
+            {
+                double deviation = elements[i] - pivot;
+                sum += elements[i];
+                squares += deviation * deviation;
+                prefixSums[i + 1] = sum;
+                prefixSquares[i + 1] = squares;
+            }
+        });
+        vector<WideSumType<T>> sumOffsets(blockCount, WideSumType<T>(0));
+        vector<double> squareOffsets(blockCount, 0.0);
+        for (size_t block = 1; block < blockCount; block++)
+        {
+            size_t previousEnd = block * blockSize;
+            sumOffsets[block] = sumOffsets[block - 1] + prefixSums[previousEnd];
+            squareOffsets[block] = squareOffsets[block - 1] + prefixSquares[previousEnd];
+        }
+        parallelFor(blockCount, [&](size_t block)
+        {
+            for (size_t i = block * blockSize; i < min(n, (block + 1) * blockSize); i++)
+            {
+                prefixSums[i + 1] += sumOffsets[block];
+                prefixSquares[i + 1] += squareOffsets[block];
+            }
+        });
+
+        _rangeIndexCache.emplace(RangeIndex {
+            .pivot = pivot,
+            .prefixSums = move(prefixSums),
+            .prefixSquares = move(prefixSquares)
+        });
+        return _rangeIndexCache.value();
     }
 
 protected:
-    vector<T> elements;
+    // Sorted unless sorted is false, see OrderPolicy. Unsorted elements are in no particular order since
+    // selection partially reorders them.
+    mutable vector<T> elements;
+    mutable bool sorted = true;
+    // While runLength is set, elements is empty and the run index, never dropped until clear() or expandRuns(),
+    // holds the runLengthSize values.
+    mutable bool runLength = false;
+    size_t runLengthSize = 0;
 
     // caches for statistics that are used many times
-    mutable optional<T> _sumCache;
+    mutable optional<pair<T, T>> _minMaxCache;
+    mutable optional<WideSumType<T>> _sumCache;
     mutable optional<double> _meanCache;
     mutable optional<double> _varianceCache;
     mutable optional<Quartiles> _quartilesCache;
+    mutable optional<Moments> _momentsCache;
+    mutable optional<double> _absoluteDeviationCache;
+    mutable optional<vector<RunEntry>> _runIndexCache;
+    mutable optional<vector<FrequencyEntry>> _frequencyTableCache;
+    mutable optional<RangeIndex> _rangeIndexCache;
+
+    LoadMode loadMode = LoadMode::Stream;
+    SortAlgorithm sortAlgorithm = SortAlgorithm::Standard;
+    OrderPolicy orderPolicy = OrderPolicy::SortOnLoad;
+    StorageMode storageMode = StorageMode::Elements;
+    LoadReport _loadReport {};
 
     /// Helpers
+    // Preconditions: A load just finished.
+    // Postconditions: The values are replaced by their runs if storageMode asks for it. Auto only looks at data the
+    //                 load sorted, and counts the runs before building them so that high cardinality data never
+    //                 pays for the run index.
+    void applyStorageMode()
+    {
+        if (storageMode == StorageMode::Elements || elements.empty())
+            return;
+        if (storageMode == StorageMode::Auto)
+        {
+            if (!sorted)
+                return;
+            size_t runCount = 1 + parallelReduce(
+                elements.size() - 1, size_t(0),
+                [this](size_t first, size_t last)
+                {
+                    size_t boundaries = 0;
+                    for (size_t i = first; i < last; i++)
+                        boundaries += elements[i] != elements[i + 1];
+                    return boundaries;
+                },
+                plus<>()
+            );
+            if (runCount > config::RUN_LENGTH_DISTINCT_RATIO * elements.size())
+                return;
+        }
+        getRunIndex();
+        runLengthSize = elements.size();
+        vector<T>().swap(elements);
+        runLength = true;
+    }
+
+    // Preconditions: None
+    // Postconditions: elements hold every value again and run-length storage is left. The run index is kept.
+    void expandRuns() const
+    {
+        if (!runLength)
+            return;
+        elements = getElements();
+        runLength = false;
+    }
+
+    // Preconditions: runLength is set and values are sorted.
+    // Postconditions: values are merged into the runs in O(runs + values) and counted in runLengthSize.
+    void mergeIntoRuns(const vector<T>& values)
+    {
+        const auto& runs = _runIndexCache.value();
+        vector<RunEntry> merged;
+        merged.reserve(runs.size() + values.size());
+        size_t offset = 0;
+        auto push = [&merged, &offset](const T& value, size_t count)
+        {
+            if (!merged.empty() && merged.back().value == value)
+                merged.back().count += count;
+            else
+                merged.push_back(RunEntry{.value = value, .count = count, .firstOffset = offset});
+            offset += count;
+        };
+        auto run = runs.cbegin();
+        auto value = values.cbegin();
+        while (run != runs.cend() || value != values.cend())
+        {
+            if (value == values.cend() || (run != runs.cend() && !(*value < run->value)))
+            {
+                push(run->value, run->count);
+                ++run;
+            }
+            else
+            {
+                auto valueEnd = findRunEnd(value, values.cend());
+                push(*value, static_cast<size_t>(std::distance(value, valueEnd)));
+                value = valueEnd;
+            }
+        }
+        merged.shrink_to_fit();
+        _runIndexCache.emplace(move(merged));
+        runLengthSize += values.size();
+    }
+
+    // Preconditions: runs are sorted by value.
+    // Postconditions: Return the moments of the values the runs stand for, one merge per run.
+    static Moments momentsOfRuns(const vector<RunEntry>& runs)
+    {
+        Moments moments;
+        for (const auto& run : runs)
+            moments.merge(Moments::fromShiftedSums(run.count, static_cast<double>(run.value), 0, 0, 0, 0));
+        return moments;
+    }
+
+    // Preconditions: runLength is set and rank < getSize().
+    // Postconditions: Return the value at index rank of the sorted values, by binary search over the runs.
+    const T& runValueAt(size_t rank) const
+    {
+        const auto& runs = getRunIndex();
+        auto run = upper_bound(runs.cbegin(), runs.cend(), rank,
+                               [](size_t r, const RunEntry& entry) { return r < entry.firstOffset; });
+        return prev(run)->value;
+    }
+
+    // Preconditions: runLength is set.
+    // Postconditions: Return the first run whose value is not below value, or is above it.
+    template <typename Bound>
+    auto lowerBoundRun(const Bound& value) const
+    {
+        const auto& runs = getRunIndex();
+        return lower_bound(runs.cbegin(), runs.cend(), value,
+                           [](const RunEntry& entry, const Bound& v) { return entry.value < v; });
+    }
+
+    template <typename Bound>
+    auto upperBoundRun(const Bound& value) const
+    {
+        const auto& runs = getRunIndex();
+        return upper_bound(runs.cbegin(), runs.cend(), value,
+                           [](const Bound& v, const RunEntry& entry) { return v < entry.value; });
+    }
+
+    // Preconditions: run is an iterator into the run index.
+    // Postconditions: Return the index of the first value of run, getSize() for the end.
+    size_t runOffsetAt(typename vector<RunEntry>::const_iterator run) const
+    {
+        return run == getRunIndex().cend() ? getSize() : run->firstOffset;
+    }
+
+    // Preconditions: runLength is set and the outlier fence exists.
+    // Postconditions: Return the end of the runs below the lower fence and the first run above the upper fence.
+    pair<typename vector<RunEntry>::const_iterator, typename vector<RunEntry>::const_iterator> getOutlierRuns() const
+    {
+        auto fence = getOutlierFence();
+        const auto& runs = getRunIndex();
+        if (!fence.has_value())
+            return {runs.cbegin(), runs.cend()};
+        auto lowEnd = lowerBoundRun(fence->first);
+        return {lowEnd, max(lowEnd, upperBoundRun(fence->second))};
+    }
+
+    // Preconditions: runLength is set.
+    // Postconditions: visit is called for every run whose value lies in [low, high].
+    template <typename Visit>
+    void visitRunsInRange(const T& low, const T& high, Visit&& visit) const
+    {
+        if (high < low)
+            return;
+        for (auto run = lowerBoundRun(low); run != getRunIndex().cend() && !(high < run->value); ++run)
+            visit(*run);
+    }
+
+    // Preconditions: data points to n values.
+    // Postconditions: Return the moments of the values.
+    static Moments momentsOf(const T* data, size_t n)
+    {
+        // Each cache sized block is reduced twice by the vector kernels, once for its mean and once for the
+        // deviations around it, then merged; memory is still only streamed once. Integer means come from the wide
+        // sum, since a long long sum of 64-bit values can overflow.
+        return parallelReduce(
+            n, Moments(),
+            [data](size_t first, size_t last)
+            {
+                const size_t blockSize = 4096;
+                Moments partial;
+                for (size_t blockStart = first; blockStart < last; blockStart += blockSize)
+                {
+                    const T* block = data + blockStart;
+                    size_t blockLength = min(blockSize, last - blockStart);
+                    double pivot;
+                    if constexpr (is_integral_v<T>)
+                    {
+                        WideAccumulator<T> blockSum;
+                        blockSum.addBlock(block, blockLength);
+                        pivot = static_cast<double>(blockSum.value()) / blockLength;
+                    }
+                    else
+                        pivot = kernelSum(block, blockLength) / blockLength;
+                    CentralSums sums = kernelCentralSums(block, blockLength, pivot);
+                    partial.merge(Moments::fromShiftedSums(blockLength, pivot, sums.s1, sums.s2, sums.s3, sums.s4));
+                }
+                return partial;
+            },
+            [](Moments left, const Moments& right) { left.merge(right); return left; }
+        );
+    }
+
+    // Preconditions: Instance was initialized with more than 0 element.
+    // Postconditions: Return the minimum and maximum found by a parallel scan, used while elements are unsorted.
+    const pair<T, T>& getMinMax() const
+    {
+        if (!_minMaxCache.has_value())
+        {
+            _minMaxCache.emplace(parallelReduce(
+                elements.size(), make_pair(elements.front(), elements.front()),
+                [this](size_t first, size_t last) { return kernelMinMax(elements.data() + first, last - first); },
+                [](const pair<T, T>& left, const pair<T, T>& right)
+                {
+                    return make_pair(min(left.first, right.first), max(left.second, right.second));
+                }
+            ));
+        }
+        return _minMaxCache.value();
+    }
+
+    // Preconditions: A path to a text file
+    // Postconditions: elements holds every value read by ifstream >> T. Return the file size in bytes.
+    size_t loadStreamFile(const string& path)
+    {
+        ifstream statsFile(path, ios::in);
+        if (!statsFile.is_open())
+            throw UIExcept("Cannot open file");
+        clear();
+        T currentValue;
+        while (statsFile >> currentValue)
+            elements.push_back(currentValue);
+
+        error_code ignored;
+        auto fileSize = filesystem::file_size(path, ignored);
+        return fileSize == static_cast<uintmax_t>(-1) ? 0 : static_cast<size_t>(fileSize);
+    }
+
+    // Preconditions: A path to a regular text file
+    // Postconditions: elements holds every value parsed straight out of the file mapping. Return the file size in bytes.
+    size_t loadMappedFile(const string& path)
+    {
+        MappedFile file(path);
+        clear();
+        elements.reserve(estimateNumberCount(file.begin(), file.end()));
+        bool stoppedEarly;
+        parseNumbers(file.begin(), file.end(), elements, stoppedEarly);
+        return file.size();
+    }
+
+    // Preconditions: A path to a regular text file
+    // Postconditions: elements holds the same values as loadMappedFile, parsed chunk by chunk on worker threads.
+    //                 Return the file size in bytes.
+    size_t loadMappedFileInParallel(const string& path)
+    {
+        const size_t minimumChunkBytes = 1 << 20;
+        MappedFile file(path);
+        clear();
+
+        size_t chunkCount = min(workerThreadCount(), max<size_t>(1, file.size() / minimumChunkBytes));
+        // Chunk boundaries are moved forward onto a separator so that no token is ever split.
+        vector<const char*> boundaries {file.begin()};
+        for (size_t i = 1; i < chunkCount; i++)
+        {
+            const char* boundary = max(boundaries.back(), file.begin() + file.size() / chunkCount * i);
+            while (boundary != file.end() && !isNumberSeparator(*boundary))
+                boundary++;
+            boundaries.push_back(boundary);
+        }
+        boundaries.push_back(file.end());
+
+        vector<vector<T>> chunkValues(chunkCount);
+        auto stoppedEarly = make_unique<bool[]>(chunkCount);
+        parallelFor(chunkCount, [&](size_t chunk)
+        {
+            chunkValues[chunk].reserve(estimateNumberCount(boundaries[chunk], boundaries[chunk + 1]));
+            parseNumbers(boundaries[chunk], boundaries[chunk + 1], chunkValues[chunk], stoppedEarly[chunk]);
+        });
+
+        // A bad token ends the load just like it ends the serial loop, so later chunks are dropped.
+        size_t usedChunks = 0, totalValues = 0;
+        vector<size_t> offsets;
+        while (usedChunks < chunkCount)
+        {
+            offsets.push_back(totalValues);
+            totalValues += chunkValues[usedChunks].size();
+            if (stoppedEarly[usedChunks++])
+                break;
+        }
+        elements.resize(totalValues);
+        parallelFor(usedChunks, [&](size_t chunk)
+        {
+            copy(chunkValues[chunk].cbegin(), chunkValues[chunk].cend(), elements.begin() + offsets[chunk]);
+            vector<T>().swap(chunkValues[chunk]);
+        });
+        return file.size();
+    }
+
+    // Preconditions: first != last and [first, last) is sorted.
+    // Postconditions: Return the end of the run of values equal to *first. Galloping keeps long runs at
+    //                 O(log run length) instead of a linear walk.
+    static auto findRunEnd(typename vector<T>::const_iterator first, typename vector<T>::const_iterator last)
+    {
+        auto low = first + 1;
+        size_t step = 1;
+        while (low != last && *low == *first)
+        {
+            size_t remaining = static_cast<size_t>(std::distance(low, last));
+            if (step >= remaining)
+                return upper_bound(low, last, *first);
+            if (*(low + step) != *first)
+                return upper_bound(low, low + step, *first);
+            low += step;
+            step *= 2;
+        }
+        return low;
+    }
+
+    // Preconditions: None
+    // Postconditions: Return the index range [first, last) of the sorted elements that lie in [low, high].
+    pair<size_t, size_t> getIndexRange(const T& low, const T& high) const
+    {
+        ensureSorted();
+        if (high < low)
+            return {0, 0};
+        if (runLength)
+            return {runOffsetAt(lowerBoundRun(low)), runOffsetAt(upperBoundRun(high))};
+        auto first = lower_bound(elements.cbegin(), elements.cend(), low);
+        auto last = upper_bound(first, elements.cend(), high);
+        return {std::distance(elements.cbegin(), first), std::distance(elements.cbegin(), last)};
+    }
+
+    // Preconditions: elements are unsorted and about to be reordered by a sort or a selection.
+    // Postconditions: The moments and the absolute deviation sum are cached from the load order, so their rounding
+    //                 does not depend on whether an order statistic was asked for first.
+    void cacheOrderSensitiveSums() const
+    {
+        if (elements.empty())
+            return;
+        getMoments();
+        getAbsoluteDeviationSum();
+    }
+
+    // Preconditions: elements are unsorted.
+    // Postconditions: Every index read by the median-of-halves quartiles holds the value it would hold if elements
+    //                 were sorted, so getMedianInRange gives the same results without a full sort.
+    void selectQuartileRanks() const
+    {
+        cacheOrderSensitiveSums();
+        size_t n = elements.size();
+        size_t upperHalfStart = n % 2 == 0 ? n / 2 : n / 2 + 1;
+        vector<size_t> ranks;
+        for (auto [low, high] : { make_pair(size_t(0), n / 2), make_pair(size_t(0), n), make_pair(upperHalfStart, n) })
+        {
+            size_t distance = high - low;
+            if (distance <= 1)
+                continue;
+            ranks.push_back(low + distance / 2);
+            if (distance % 2 == 0)
+                ranks.push_back(low + distance / 2 - 1);
+        }
+        sort(ranks.begin(), ranks.end());
+        ranks.erase(unique(ranks.begin(), ranks.end()), ranks.end());
+        selectRanks(0, n, ranks.data(), ranks.data() + ranks.size());
+    }
+
+    // Preconditions: [rankFirst, rankLast) are sorted indices within [first, last).
+    // Postconditions: elements[r] holds its sorted order value for every rank r. The middle rank is placed with
+    //                 nth_element and the ranks on either side recurse into their own partition only.
+    void selectRanks(size_t first, size_t last, const size_t* rankFirst, const size_t* rankLast) const
+    {
+        if (rankFirst == rankLast || last - first <= 1)
+            return;
+        const size_t* middle = rankFirst + (rankLast - rankFirst) / 2;
+        nth_element(elements.begin() + first, elements.begin() + *middle, elements.begin() + last);
+        selectRanks(first, *middle, rankFirst, middle);
+        selectRanks(*middle + 1, last, middle + 1, rankLast);
+    }
+
     optional<double> getMedianInRange(decltype(elements.cbegin()) lowBound, decltype(elements.cbegin()) highBound) const
     {
         ptrdiff_t distance = std::distance(lowBound, highBound);
@@ -2,6 +2,7 @@
 // Date: 02/18/2020
 // Description: Implements methods that display choices and process user choices.
 
+#include <memory>
 #include "statisticsUI.h"
 #include "ui/configuration.h"
 
@@ -38,25 +39,30 @@ void StatsUI::showCurrentState()
         L"S> Root Mean Square",
         L"T> Standard Error of the Mean",
         L"U> Coefficient of Variation",
-        L"V> Relative Standard Deviation"
+        L"V> Relative Standard Deviation",
+        L"X> Stream data file (bounded memory)",
+        L"Y> Sort data file out of core"
     );
-    Table({ optionColumn1, optionColumn2 }, L"3> Descriptive Statistics").dumpTableTo(wcout);
+    Table({ optionColumn1, optionColumn2 }, L"3> Descriptive Statistics").dumpTableTo(consoleSink());
 }
 
 
 void StatsUI::init()
 {
     this->terminateCharacter = '0';
-    choiceCollector = CharParameter ("Option: ", [this](const char& c){ return c == terminateCharacter || (tolower(c) >= 'a' && tolower(c) <= 'w');});
+    setLoadMode(LoadMode::ParallelMapped);
+    setSortAlgorithm(SortAlgorithm::Radix);
+    setStorageMode(StorageMode::Auto);
+    choiceCollector = CharParameter ("Option: ", [this](const char& c){ return c == terminateCharacter || (tolower(c) >= 'a' && tolower(c) <= 'y');});
 
-    auto nonEmptyVector = shared_ptr<AbstractPrerequisite>( new RequireNonEmptyVector(ref(elements), "No elements in array"));
+    auto nonEmptyVector = shared_ptr<AbstractPrerequisite>( new InvokeMethodRequirement([this]() { return getSize() > 0; }, "No elements in array"));
 
     addOption('a', bind(&StatsUI::loadFileOptionHandler, this, _1), StringParameter("Enter file path: "));
     addOption('b', statsDisplayAdapter(L"Minimum", bind(&Statistics::getMin, this))) .require(nonEmptyVector);
     addOption('c', statsDisplayAdapter(L"Maximum", bind(&Statistics::getMax, this))) .require(nonEmptyVector);
     addOption('d', statsDisplayAdapter(L"Range", bind(&Statistics::getRange, this))) .require(nonEmptyVector);
     addOption('e', statsDisplayAdapter(L"Size", bind(&Statistics::getSize, this))) .require(nonEmptyVector);
-    addOption('f', statsDisplayAdapter(L"Sum", bind(&Statistics::getSum, this))) .require(nonEmptyVector);
+    addOption('f', statsDisplayAdapter(L"Sum", [this]() { return to_wstring(getSum()); })) .require(nonEmptyVector);
     addOption('g', statsDisplayAdapter(L"Mean", bind(&Statistics::getMean, this))) .require(nonEmptyVector);
     addOption('h', statsDisplayAdapter(L"Median", bind(&Statistics::getMedian, this))).require(nonEmptyVector);
     addOption('i', frequencyTableDisplayAdapter(bind(&Statistics::getFrequencyTable, this))).require(nonEmptyVector);
@@ -74,16 +80,21 @@ void StatsUI::init()
     addOption('u', statsDisplayAdapter(L"Coefficient of Variation", bind(&Statistics::getCoefficientOfVariation, this))).require(nonEmptyVector);
     addOption('v', statsDisplayAdapter(L"Relative Standard Deviation", bind(&Statistics::getRelativeStd, this))).require(nonEmptyVector);
     addOption('w', bind(&StatsUI::displayAllResultAndWriteToFile, this)).require(nonEmptyVector);
+    addOption('x', bind(&StatsUI::streamFileOptionHandler, this, _1), StringParameter("Enter file path: "));
+    addOption('y', bind(&StatsUI::externalFileOptionHandler, this, _1), StringParameter("Enter file path: "));
 }
 
 void StatsUI::loadFileOptionHandler(string&& path)
 {
     Statistics::loadDataFromFilePath(path);
     wcout << "File opened successfully!" << endl;
-    auto* numbers = new MixedColumn(DEFAULT_LEFT_PADDING, DEFAULT_RIGHT_PADDING, L"");
-    numbers->addItems(elements);
+    const auto& report = getLoadReport();
+    wcout << L"Parsed " << report.valuesParsed << L" values (" << report.bytesRead << L" bytes) in "
+          << report.parseSeconds << L"s: " << static_cast<long long>(report.valuesPerSecond) << L" values/sec" << endl;
+    auto* numbers = new SpanColumn<long, ElementView>(DEFAULT_LEFT_PADDING, DEFAULT_RIGHT_PADDING, L"",
+                                                      getElementView(), DATA_HEAD_LINES, DATA_TAIL_LINES);
     auto table = Table({numbers}, L"Data");
-    table.dumpTableTo(wcout);
+    table.dumpTableTo(consoleSink());
     wcout << endl;
 }
 
@@ -96,7 +107,7 @@ function<void(void)> StatsUI::statsDisplayAdapter(WideString name, Func statsGet
         auto* nameColumn = new MixedColumn(DEFAULT_LEFT_PADDING, DEFAULT_RIGHT_PADDING, L"", name);
         auto* equalColumn = new MixedColumn(DEFAULT_LEFT_PADDING, DEFAULT_RIGHT_PADDING, L"", L"=");
         auto* statColumn = new MixedColumn(DEFAULT_LEFT_PADDING, DEFAULT_RIGHT_PADDING, L"", stat);
-        Table({nameColumn, equalColumn, statColumn}, L"Result: ").dumpTableTo(wcout);
+        Table({nameColumn, equalColumn, statColumn}, L"Result: ").dumpTableTo(consoleSink());
     };
 }
 
@@ -110,14 +121,14 @@ function<void(void)> StatsUI::quartilesDisplayAdapter(Func quartilesGetter)
         auto* equalColumn = new MixedColumn(DEFAULT_LEFT_PADDING, DEFAULT_RIGHT_PADDING, L"");
         equalColumn->repeatedAddItems(vector<wstring>(3, L"-->"));
         auto* statsColumn = new MixedColumn(DEFAULT_LEFT_PADDING, DEFAULT_RIGHT_PADDING, L"", quartiles.Q1, quartiles.Q2, quartiles.Q3);
-        Table({nameColumn, equalColumn, statsColumn}, L"Quartiles: ").dumpTableTo(wcout);
+        Table({nameColumn, equalColumn, statsColumn}, L"Quartiles: ").dumpTableTo(consoleSink());
     };
 }
 
 template <typename Func>
 Table* StatsUI::frequencyTableToUITable(Func frequencyTableGetter)
 {
-    auto freqTable = frequencyTableGetter();
+    const auto& freqTable = frequencyTableGetter();
     vector<long> values;
     transform(freqTable.begin(), freqTable.end(), back_inserter(values), mem_fn(&FrequencyEntry::value));
     vector<long> frequency;
@@ -144,12 +155,13 @@ function<void(void)> StatsUI::frequencyTableDisplayAdapter(Func frequencyTableGe
     return [this, frequencyTableGetter] ()
     {
         auto* table = frequencyTableToUITable(frequencyTableGetter);
-        table->dumpTableTo(wcout);
+        table->dumpTableTo(consoleSink());
         delete table;
     };
 }
 
-void StatsUI::displayAllResultAndWriteToFile()
+template <typename Stats, typename DataItem, typename FrequencyItem>
+Table StatsUI::summaryTable(Stats& stats, DataItem data, FrequencyItem frequencies)
 {
     auto* statisticNameColumn = new MixedColumn (DEFAULT_LEFT_PADDING, DEFAULT_RIGHT_PADDING,L"Concept");
     statisticNameColumn->addItems(
@@ -180,60 +192,163 @@ void StatsUI::displayAllResultAndWriteToFile()
         L"Frequency Table"
     );
 
-    const auto& quartiles = getQuartiles();
+    const auto& quartiles = stats.getQuartiles();
     auto* quartileNames = new MixedColumn(DEFAULT_LEFT_PADDING, DEFAULT_RIGHT_PADDING, L"", "Q1", "Q2", "Q3");
     auto* arrowColumn = new MixedColumn(DEFAULT_LEFT_PADDING, DEFAULT_RIGHT_PADDING, L"");
     arrowColumn->repeatedAddItems(vector<const char*>(3, "-->"));
     auto* quartileValues = new MixedColumn(DEFAULT_LEFT_PADDING, DEFAULT_RIGHT_PADDING, L"", quartiles.Q1, quartiles.Q2, quartiles.Q3);
     auto* quartileTable = new Table({quartileNames, arrowColumn, quartileValues}, L"", -1, false);
 
-    auto* numbersColumn = new MixedColumn(DEFAULT_LEFT_PADDING, DEFAULT_RIGHT_PADDING, L"");
-    numbersColumn->addItems(elements);
-    auto* dataTable = new Table({numbersColumn}, L"", -1 , false);
-
     auto* statisticValueColumn = new MixedColumn(DEFAULT_LEFT_PADDING, DEFAULT_RIGHT_PADDING, L"Values");
     statisticValueColumn->addItems(
-        dataTable,
-        getMin(),
-        getMax(),
-        getRange(),
-        getSize(),
-        getSum(),
-        getMean(),
-        getMedian(),
-        getMode(),
-        getStandardDeviation(),
-        getVariance(),
-        getMidRange(),
+        data,
+        stats.getMin(),
+        stats.getMax(),
+        stats.getRange(),
+        stats.getSize(),
+        to_wstring(stats.getSum()),
+        stats.getMean(),
+        stats.getMedian(),
+        stats.getMode(),
+        stats.getStandardDeviation(),
+        stats.getVariance(),
+        stats.getMidRange(),
         quartileTable,
-        getIQR(),
-        getOutliers(),
-        getSumOfSquares(),
-        getMeanAbsoluteDeviation(),
-        getRootMeanSquare(),
-        getStdErrorOfMean(),
-        getSkewness(),
-        getKurtosis(),
-        getKurtosisExcess(),
-        getCoefficientOfVariation(),
-        to_wstring(getRelativeStd()) + L"%",
-        frequencyTableToUITable(bind(&Statistics::getFrequencyTable, this))
+        stats.getIQR(),
+        stats.getOutliers(),
+        stats.getSumOfSquares(),
+        stats.getMeanAbsoluteDeviation(),
+        stats.getRootMeanSquare(),
+        stats.getStdErrorOfMean(),
+        stats.getSkewness(),
+        stats.getKurtosis(),
+        stats.getKurtosisExcess(),
+        stats.getCoefficientOfVariation(),
+        to_wstring(stats.getRelativeStd()) + L"%",
+        frequencies
     );
 
     auto* equalColumn = new MixedColumn(DEFAULT_LEFT_PADDING, 2, L"");
     equalColumn->repeatedAddItems(vector<const wchar_t*>(24, L"="));
 
-    auto table = Table({statisticNameColumn, equalColumn, statisticValueColumn}, L"Statistics");
-    table.dumpTableTo(wcout);
+    return Table({statisticNameColumn, equalColumn, statisticValueColumn}, L"Statistics");
+}
 
+void StatsUI::writeTableToUserFile(const Table& table)
+{
     auto filePath = StringParameter ("Enter file path: ").collectParam();
-    auto outFile = wofstream (filePath);
-    while (!outFile.is_open())
+    auto outFile = make_unique<Utf8FileSink>(filePath);
+    while (!outFile->isOpen())
     {
         wcout << L"ERROR: Cannot open file. Try again." << endl;
         filePath = StringParameter ("Enter file path: ").collectParam();
-        outFile = wofstream (filePath);
+        outFile = make_unique<Utf8FileSink>(filePath);
     }
-    table.dumpTableTo(outFile);
+    table.dumpTableTo(*outFile);
     wcout << L"Summary was written to file." << endl;
+}
+
+void StatsUI::displayAllResultAndWriteToFile()
+{
+    auto* numbersColumn = new SpanColumn<long, ElementView>(DEFAULT_LEFT_PADDING, DEFAULT_RIGHT_PADDING, L"",
+                                                            getElementView(), DATA_HEAD_LINES, DATA_TAIL_LINES);
+    auto* dataTable = new Table({numbersColumn}, L"", -1 , false);
+
+    auto table = summaryTable(*this, dataTable, frequencyTableToUITable(bind(&Statistics::getFrequencyTable, this)));
+    table.dumpTableTo(consoleSink());
+    // The saved report keeps every value; only the console is cut to its first and last lines.
+    numbersColumn->setTruncation(0, 0);
+    writeTableToUserFile(table);
+}
+
+void StatsUI::externalFileOptionHandler(string&& path)
+{
+    externalStats.loadDataFromFilePath(path);
+    const auto& report = externalStats.getLoadReport();
+    wcout << L"Sorted " << report.valuesParsed << L" values (" << report.bytesRead << L" bytes) in "
+          << report.parseSeconds << L"s with " << externalStats.getRunCount() << L" runs spilled to disk" << endl;
+    if (externalStats.getSize() == 0)
+    {
+        wcout << L"No elements in file" << endl;
+        return;
+    }
+
+    // The values themselves stay on disk, so the Data row names the file instead of listing them.
+    auto data = to_wstring(externalStats.getSize()) + L" values in " + wstring(path.begin(), path.end());
+    auto getFrequencyTable = [this]() -> decltype(auto) { return externalStats.getFrequencyTable(); };
+    if (externalStats.isFrequencyTableComplete())
+    {
+        auto table = summaryTable(externalStats, data, frequencyTableToUITable(getFrequencyTable));
+        table.dumpTableTo(consoleSink());
+        writeTableToUserFile(table);
+    }
+    else
+    {
+        auto table = summaryTable(externalStats, data, wstring(L"Too many distinct values to list"));
+        table.dumpTableTo(consoleSink());
+        writeTableToUserFile(table);
+    }
+}
+
+void StatsUI::streamFileOptionHandler(string&& path)
+{
+    streamingStats.loadDataFromFilePath(path);
+    const auto& report = streamingStats.getLoadReport();
+    wcout << L"Streamed " << report.valuesParsed << L" values (" << report.bytesRead << L" bytes) in "
+          << report.parseSeconds << L"s: " << static_cast<long long>(report.valuesPerSecond) << L" values/sec" << endl;
+    if (streamingStats.getSize() == 0)
+    {
+        wcout << L"No elements in file" << endl;
+        return;
+    }
+
+    auto* statisticNameColumn = new MixedColumn (DEFAULT_LEFT_PADDING, DEFAULT_RIGHT_PADDING, L"Concept");
+    statisticNameColumn->addItems(
+        L"Minimum",
+        L"Maximum",
+        L"Size",
+        L"Sum",
+        L"Mean",
+        L"Standard Deviation",
+        L"Variance",
+        L"Median",
+        L"Quartiles",
+        L"Interquartile Range",
+        L"Outliers",
+        L"Mode",
+        L"Skewness",
+        L"Kurtosis",
+        L"Rank Error"
+    );
+
+    const auto& quartiles = streamingStats.getQuartiles();
+    auto* quartileNames = new MixedColumn(DEFAULT_LEFT_PADDING, DEFAULT_RIGHT_PADDING, L"", "Q1", "Q2", "Q3");
+    auto* arrowColumn = new MixedColumn(DEFAULT_LEFT_PADDING, DEFAULT_RIGHT_PADDING, L"");
+    arrowColumn->repeatedAddItems(vector<const char*>(3, "-->"));
+    auto* quartileValues = new MixedColumn(DEFAULT_LEFT_PADDING, DEFAULT_RIGHT_PADDING, L"", quartiles.Q1, quartiles.Q2, quartiles.Q3);
+    auto* quartileTable = new Table({quartileNames, arrowColumn, quartileValues}, L"", -1, false);
+
+    auto* statisticValueColumn = new MixedColumn(DEFAULT_LEFT_PADDING, DEFAULT_RIGHT_PADDING, L"Values");
+    statisticValueColumn->addItems(
+        streamingStats.getMin(),
+        streamingStats.getMax(),
+        static_cast<size_t>(streamingStats.getSize()),
+        to_wstring(streamingStats.getSum()),
+        streamingStats.getMean(),
+        streamingStats.getStandardDeviation(),
+        streamingStats.getVariance(),
+        streamingStats.getMedian(),
+        quartileTable,
+        streamingStats.getIQR(),
+        streamingStats.getOutliers(),
+        streamingStats.getMode(),
+        streamingStats.getSkewness(),
+        streamingStats.getKurtosis(),
+        streamingStats.isExact() ? wstring(L"exact") : to_wstring(100 * streamingStats.getNormalizedRankError()) + L"%"
+    );
+
+    auto* equalColumn = new MixedColumn(DEFAULT_LEFT_PADDING, 2, L"");
+    equalColumn->repeatedAddItems(vector<const wchar_t*>(16, L"="));
+
+    Table({statisticNameColumn, equalColumn, statisticValueColumn}, L"Streaming Statistics").dumpTableTo(consoleSink());
 }
\ No newline at end of file
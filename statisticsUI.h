@@ -8,7 +8,10 @@
 #include <iostream>
 #include "ui/OptionUI.h"
 #include "statistics.h"
+#include "streamingStatistics.h"
+#include "externalStatistics.h"
 #include "ui/MixedColumn.h"
+#include "ui/SpanColumn.h"
 
 using namespace std::placeholders;
 
@@ -51,9 +54,32 @@ public:
     template <typename Func>
     std::function<void(void)> frequencyTableDisplayAdapter(Func frequencyTableGetter);
 
+    // Preconditions: Expect an object with the getters of Statistics and the items shown in the Data and Frequency
+    //                 Table rows.
+    // Postconditions: Return the summary table of all stats.
+    template <typename Stats, typename DataItem, typename FrequencyItem>
+    Table summaryTable(Stats& stats, DataItem data, FrequencyItem frequencies);
+
+    // Preconditions: None.
+    // Postconditions: Ask for file paths until one opens, then write table to it.
+    void writeTableToUserFile(const Table& table);
+
     // Preconditions: None.
     // Postconditions: Display all stat then write summary to user-specified location.
     void displayAllResultAndWriteToFile();
+
+    // Preconditions: Expect a file path
+    // Postconditions: Summarizes the file in bounded memory without loading it and displays the summary.
+    void streamFileOptionHandler(std::string&& path);
+
+    // Preconditions: Expect a file path
+    // Postconditions: Computes every stat of a file that may not fit in memory with an external sort, then
+    //                 displays and writes the same summary as option W.
+    void externalFileOptionHandler(std::string&& path);
+
+protected:
+    StreamingStatistics<long> streamingStats;
+    ExternalStatistics<long> externalStats;
 };
 
 #endif //PROJ1_STATISTICSUI_H
@@ -0,0 +1,162 @@
+// Name : Long Duong
+// Date: 10/17/2026
+// Description: An open-addressing value to count hash table used to count frequencies without sorting.
+
+#ifndef PROJ1_COUNTTABLE_H
+#define PROJ1_COUNTTABLE_H
+
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <type_traits>
+#include "parallel.h"
+
+using namespace std;
+
+// Linear probing over one flat array of (value, count) slots; a count of 0 marks an empty slot. The table doubles
+// once it is half full, which keeps probe sequences short and within a cache line or two.
+template <typename T>
+class CountTable
+{
+public:
+    // Preconditions: None
+    // Postconditions: Instance is an empty table with room for at least expectedDistinct values.
+    explicit CountTable(size_t expectedDistinct = 16) :
+        slots(slotCountFor(expectedDistinct)),
+        distinct {0}
+    {}
+
+    // Preconditions: data points to n values.
+    // Postconditions: Return the counts of the values. Each worker counts one slice into its own table and the
+    //                 tables are merged at the end.
+    static CountTable fromValues(const T* data, size_t n)
+    {
+        const size_t minimumSlice = 1 << 16;
+        size_t sliceCount = min(workerThreadCount(), max<size_t>(1, n / minimumSlice));
+        vector<CountTable> tables(sliceCount);
+        parallelFor(sliceCount, [&](size_t slice)
+        {
+            size_t first = n / sliceCount * slice;
+            size_t last = slice + 1 == sliceCount ? n : n / sliceCount * (slice + 1);
+            for (size_t i = first; i < last; i++)
+                tables[slice].add(data[i]);
+        });
+        for (size_t slice = 1; slice < sliceCount; slice++)
+            tables[0].merge(tables[slice]);
+        return move(tables[0]);
+    }
+
+    // Preconditions: occurrences > 0
+    // Postconditions: value is counted occurrences more times.
+    void add(const T& value, uint64_t occurrences = 1)
+    {
+        T key = normalize(value);
+        size_t mask = slots.size() - 1;
+        for (size_t index = hashOf(key) & mask; ; index = (index + 1) & mask)
+        {
+            Slot& slot = slots[index];
+            if (slot.count == 0)
+            {
+                slot.key = key;
+                slot.count = occurrences;
+                if (++distinct * 2 > slots.size())
+                    grow();
+                return;
+            }
+            if (slot.key == key)
+            {
+                slot.count += occurrences;
+                return;
+            }
+        }
+    }
+
+    // Preconditions: None
+    // Postconditions: Every count of other is added to this table.
+    void merge(const CountTable& other)
+    {
+        for (const auto& slot : other.slots)
+            if (slot.count != 0)
+                add(slot.key, slot.count);
+    }
+
+    // Preconditions: None
+    // Postconditions: Return the number of distinct values counted.
+    size_t size() const
+    {
+        return distinct;
+    }
+
+    // Preconditions: None
+    // Postconditions: Return the values and their counts in ascending value order.
+    vector<pair<T, uint64_t>> sortedEntries() const
+    {
+        vector<pair<T, uint64_t>> entries;
+        entries.reserve(distinct);
+        for (const auto& slot : slots)
+            if (slot.count != 0)
+                entries.emplace_back(slot.key, slot.count);
+        sort(entries.begin(), entries.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+        return entries;
+    }
+
+private:
+    struct Slot
+    {
+        T key;
+        uint64_t count;
+    };
+
+    vector<Slot> slots;
+    size_t distinct;
+
+    static size_t slotCountFor(size_t expectedDistinct)
+    {
+        size_t slotCount = 16;
+        while (slotCount < expectedDistinct * 2)
+            slotCount *= 2;
+        return slotCount;
+    }
+
+    // -0.0 and 0.0 compare equal and must land in the same slot.
+    static T normalize(const T& value)
+    {
+        if constexpr (is_floating_point_v<T>)
+            return value == 0 ? T(0) : value;
+        else
+            return value;
+    }
+
+    // splitmix64 finalizer over the bit pattern of the value.
+    static size_t hashOf(const T& value)
+    {
+        uint64_t bits = 0;
+        memcpy(&bits, &value, min(sizeof(T), sizeof(bits)));
+        bits ^= bits >> 30;
+        bits *= 0xbf58476d1ce4e5b9ULL;
+        bits ^= bits >> 27;
+        bits *= 0x94d049bb133111ebULL;
+        bits ^= bits >> 31;
+        return static_cast<size_t>(bits);
+    }
+
+    void grow()
+    {
+        vector<Slot> oldSlots(slots.size() * 2);
+        oldSlots.swap(slots);
+        size_t mask = slots.size() - 1;
+        for (const auto& slot : oldSlots)
+        {
+            if (slot.count == 0)
+                continue;
+            size_t index = hashOf(slot.key) & mask;
+            while (slots[index].count != 0)
+                index = (index + 1) & mask;
+            slots[index] = slot;
+        }
+    }
+};
+
+#endif //PROJ1_COUNTTABLE_H
@@ -0,0 +1,224 @@
+// Name : Long Duong
+// Date: 10/17/2026
+// Description: An external merge sort that keeps at most a fixed memory budget of values in memory.
+
+#ifndef PROJ1_EXTERNALSORT_H
+#define PROJ1_EXTERNALSORT_H
+
+#include <vector>
+#include <string>
+#include <fstream>
+#include <filesystem>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <type_traits>
+#include "sorting.h"
+#include "../ui/UIExcept.h"
+
+using namespace std;
+
+// Values are buffered until the budget is used, then the buffer is sorted and spilled to a temporary file as one
+// sorted run. merge() replays every run in ascending order through a k-way merge, reading each run in blocks that
+// share the budget. A data set that fits the budget is never spilled. Spill files are deleted with the instance.
+template <typename T>
+class ExternalSort
+{
+public:
+    static_assert(is_trivially_copyable_v<T>, "runs are spilled as raw values");
+
+    // Preconditions: memoryBudgetBytes leaves room for at least a few values.
+    // Postconditions: Instance is empty and spills into directory.
+    explicit ExternalSort(size_t memoryBudgetBytes, filesystem::path directory = filesystem::temp_directory_path()) :
+        // The radix and merge sorts need a second buffer as large as the values.
+        bufferCapacity {max<size_t>(16, memoryBudgetBytes / (2 * sizeof(T)))},
+        spillDirectory {move(directory)},
+        spillPrefix {"stats_run_" + to_string(chrono::steady_clock::now().time_since_epoch().count()) + "_"
+                     + to_string(reinterpret_cast<uintptr_t>(this))},
+        count {0},
+        finished {false}
+    {}
+
+    ExternalSort(const ExternalSort&) = delete;
+    ExternalSort& operator=(const ExternalSort&) = delete;
+
+    ~ExternalSort()
+    {
+        removeRuns();
+    }
+
+    // Preconditions: finish() was not called since the last clear().
+    // Postconditions: value is buffered, spilling the buffer as a sorted run once it is full.
+    void push(const T& value)
+    {
+        // Grown by hand so that doubling never allocates past the budget.
+        if (buffer.size() == buffer.capacity())
+            buffer.reserve(min(bufferCapacity, max<size_t>(1024, 2 * buffer.capacity())));
+        buffer.push_back(value);
+        count++;
+        if (buffer.size() == bufferCapacity)
+            spill();
+    }
+
+    // Preconditions: None
+    // Postconditions: Every pushed value is in a sorted run, the last one in memory if nothing was spilled.
+    void finish()
+    {
+        if (finished)
+            return;
+        if (runPaths.empty())
+        {
+            sortValues(buffer, SortAlgorithm::Radix);
+            sortedInMemory = move(buffer);
+        }
+        else if (!buffer.empty())
+            spill();
+        vector<T>().swap(buffer);
+        finished = true;
+    }
+
+    // Preconditions: finish() was called. visit is callable with (const T& value) and returns whether to go on.
+    // Postconditions: visit is called for every value in ascending order until it returns false.
+    template <typename Visit>
+    void merge(Visit&& visit) const
+    {
+        if (runPaths.empty())
+        {
+            for (const auto& value : sortedInMemory)
+                if (!visit(value))
+                    return;
+            return;
+        }
+
+        size_t blockLength = max<size_t>(1, bufferCapacity / runPaths.size());
+        vector<RunCursor> cursors(runPaths.size());
+        // Min-heap of (head value, run) pairs.
+        vector<pair<T, size_t>> heads;
+        auto greaterHead = [](const pair<T, size_t>& a, const pair<T, size_t>& b) { return b.first < a.first; };
+        for (size_t run = 0; run < runPaths.size(); run++)
+        {
+            cursors[run].open(runPaths[run], blockLength);
+            if (cursors[run].hasValue())
+                heads.emplace_back(cursors[run].value(), run);
+        }
+        make_heap(heads.begin(), heads.end(), greaterHead);
+        while (!heads.empty())
+        {
+            pop_heap(heads.begin(), heads.end(), greaterHead);
+            auto [value, run] = heads.back();
+            if (!visit(value))
+                return;
+            if (cursors[run].advance())
+            {
+                heads.back().first = cursors[run].value();
+                push_heap(heads.begin(), heads.end(), greaterHead);
+            }
+            else
+                heads.pop_back();
+        }
+    }
+
+    // Preconditions: None
+    // Postconditions: Return the number of values pushed.
+    uint64_t size() const
+    {
+        return count;
+    }
+
+    // Preconditions: None
+    // Postconditions: Return the number of runs spilled to disk.
+    size_t getRunCount() const
+    {
+        return runPaths.size();
+    }
+
+    // Preconditions: None
+    // Postconditions: All values and spill files are dropped.
+    void clear()
+    {
+        removeRuns();
+        vector<T>().swap(buffer);
+        vector<T>().swap(sortedInMemory);
+        count = 0;
+        finished = false;
+    }
+
+private:
+    // Reads one run back in blocks of blockLength values.
+    class RunCursor
+    {
+    public:
+        void open(const filesystem::path& path, size_t _blockLength)
+        {
+            file.open(path, ios::in | ios::binary);
+            if (!file.is_open())
+                throw UIExcept("Cannot open spill file");
+            blockLength = _blockLength;
+            refill();
+        }
+
+        bool hasValue() const
+        {
+            return position < block.size();
+        }
+
+        const T& value() const
+        {
+            return block[position];
+        }
+
+        bool advance()
+        {
+            if (++position == block.size())
+                refill();
+            return hasValue();
+        }
+
+    private:
+        ifstream file;
+        vector<T> block;
+        size_t blockLength = 0;
+        size_t position = 0;
+
+        void refill()
+        {
+            block.resize(blockLength);
+            file.read(reinterpret_cast<char*>(block.data()), blockLength * sizeof(T));
+            block.resize(static_cast<size_t>(file.gcount()) / sizeof(T));
+            position = 0;
+        }
+    };
+
+    vector<T> buffer;
+    vector<T> sortedInMemory;
+    vector<filesystem::path> runPaths;
+    size_t bufferCapacity;
+    filesystem::path spillDirectory;
+    string spillPrefix;
+    uint64_t count;
+    bool finished;
+
+    void spill()
+    {
+        sortValues(buffer, SortAlgorithm::Radix);
+        auto path = spillDirectory / (spillPrefix + "_" + to_string(runPaths.size()) + ".bin");
+        ofstream file(path, ios::out | ios::binary | ios::trunc);
+        if (!file.is_open())
+            throw UIExcept("Cannot create spill file");
+        runPaths.push_back(path);
+        file.write(reinterpret_cast<const char*>(buffer.data()), buffer.size() * sizeof(T));
+        if (!file)
+            throw UIExcept("Cannot write spill file");
+        buffer.clear();
+    }
+
+    void removeRuns()
+    {
+        error_code ignored;
+        for (const auto& path : runPaths)
+            filesystem::remove(path, ignored);
+        runPaths.clear();
+    }
+};
+
+#endif //PROJ1_EXTERNALSORT_H
@@ -0,0 +1,145 @@
+// Name : Long Duong
+// Date: 10/17/2026
+// Description: A Misra-Gries heavy hitter summary that counts values exactly until it runs out of counters.
+
+#ifndef PROJ1_FREQUENCYSKETCH_H
+#define PROJ1_FREQUENCYSKETCH_H
+
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <functional>
+#include "binaryIO.h"
+#include "../ui/configuration.h"
+#include "../ui/UIExcept.h"
+
+using namespace std;
+
+template <typename T>
+class FrequencySketch
+{
+public:
+    // Preconditions: capacity > 0
+    // Postconditions: Instance tracks up to capacity distinct values.
+    explicit FrequencySketch(size_t _capacity = config::FREQUENCY_SKETCH_CAPACITY) :
+        capacity {_capacity},
+        maximumError {0}
+    {}
+
+    // Preconditions: None
+    // Postconditions: occurrences copies of value are counted. When all counters are taken, every counter is
+    //                 lowered by the same amount until one frees up, which bounds the undercount of any value.
+    void push(const T& value, uint64_t occurrences = 1)
+    {
+        auto existing = counters.find(value);
+        if (existing != counters.end())
+        {
+            existing->second += occurrences;
+            return;
+        }
+        if (counters.size() >= capacity)
+        {
+            uint64_t decrement = occurrences;
+            for (const auto& counter : counters)
+                decrement = min(decrement, counter.second);
+            for (auto it = counters.begin(); it != counters.end();)
+            {
+                it->second -= decrement;
+                it = it->second == 0 ? counters.erase(it) : next(it);
+            }
+            occurrences -= decrement;
+            maximumError += decrement;
+        }
+        if (occurrences > 0)
+            counters.emplace(value, occurrences);
+    }
+
+    // Preconditions: None
+    // Postconditions: Instance summarizes both streams. Counters are added and, if more than capacity remain, the
+    //                 (capacity + 1)-th largest count is subtracted from all of them, which keeps the merge
+    //                 associative and the error bounded by n / (capacity + 1).
+    void merge(const FrequencySketch& other)
+    {
+        for (const auto& counter : other.counters)
+            counters[counter.first] += counter.second;
+        maximumError += other.maximumError;
+        if (counters.size() <= capacity)
+            return;
+
+        vector<uint64_t> counts;
+        counts.reserve(counters.size());
+        for (const auto& counter : counters)
+            counts.push_back(counter.second);
+        nth_element(counts.begin(), counts.begin() + capacity, counts.end(), greater<uint64_t>());
+        uint64_t decrement = counts[capacity];
+        for (auto it = counters.begin(); it != counters.end();)
+        {
+            it->second -= min(decrement, it->second);
+            it = it->second == 0 ? counters.erase(it) : next(it);
+        }
+        maximumError += decrement;
+    }
+
+    // Preconditions: None
+    // Postconditions: The capacity, error and every counter are appended to out.
+    void writeTo(ostream& out) const
+    {
+        writeBinary(out, static_cast<uint64_t>(capacity));
+        writeBinary(out, maximumError);
+        writeBinary(out, static_cast<uint64_t>(counters.size()));
+        for (const auto& counter : getCounters())
+        {
+            writeBinary(out, counter.first);
+            writeBinary(out, counter.second);
+        }
+    }
+
+    // Preconditions: in is positioned on data written by writeTo for the same T.
+    // Postconditions: Return the sketch read back or throw exception if the data is truncated or inconsistent.
+    static FrequencySketch readFrom(istream& in)
+    {
+        FrequencySketch sketch(static_cast<size_t>(readBinary<uint64_t>(in)));
+        sketch.maximumError = readBinary<uint64_t>(in);
+        uint64_t counterCount = readBinary<uint64_t>(in);
+        if (sketch.capacity == 0 || counterCount > sketch.capacity)
+            throw UIExcept("Invalid frequency sketch");
+        for (uint64_t i = 0; i < counterCount; i++)
+        {
+            T value = readBinary<T>(in);
+            sketch.counters[value] = readBinary<uint64_t>(in);
+        }
+        return sketch;
+    }
+
+    // Preconditions: None
+    // Postconditions: Return whether every count is exact, i.e. no more distinct values were seen than counters.
+    bool isExact() const
+    {
+        return maximumError == 0;
+    }
+
+    // Preconditions: None
+    // Postconditions: Return the largest amount by which any reported count can be below the true count.
+    uint64_t getMaximumError() const
+    {
+        return maximumError;
+    }
+
+    // Preconditions: None
+    // Postconditions: Return the tracked values and their (lower bound) counts in ascending value order.
+    vector<pair<T, uint64_t>> getCounters() const
+    {
+        vector<pair<T, uint64_t>> sorted(counters.cbegin(), counters.cend());
+        sort(sorted.begin(), sorted.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+        return sorted;
+    }
+
+private:
+    size_t capacity;
+    uint64_t maximumError;
+    unordered_map<T, uint64_t> counters;
+};
+
+#endif //PROJ1_FREQUENCYSKETCH_H
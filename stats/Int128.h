@@ -0,0 +1,152 @@
+// Name : Long Duong
+// Date: 10/17/2026
+// Description: A portable signed 128-bit integer, wide enough to sum any number of 64-bit values a machine can hold.
+
+#ifndef PROJ1_INT128_H
+#define PROJ1_INT128_H
+
+#include <string>
+#include <compare>
+#include <cstdint>
+#include <type_traits>
+#include <algorithm>
+
+using namespace std;
+
+// Two's complement over a signed high word and an unsigned low word, so the defaulted comparison orders values
+// correctly. Only what summation needs is provided: addition, negation, a shift, multiplication by a 64-bit count,
+// and conversion to double and text. MSVC has no __int128, hence the hand written arithmetic.
+class Int128
+{
+public:
+    constexpr Int128() :
+        high {0},
+        low {0}
+    {}
+
+    template <typename Integer, typename enable_if<is_integral<Integer>::value, int>::type = 0>
+    constexpr Int128(Integer value) :
+        high {is_signed_v<Integer> && value < 0 ? -1 : 0},
+        low {static_cast<uint64_t>(value)}
+    {}
+
+    Int128& operator+=(const Int128& other)
+    {
+        uint64_t sum = low + other.low;
+        uint64_t carry = sum < low ? 1 : 0;
+        high = static_cast<int64_t>(static_cast<uint64_t>(high) + static_cast<uint64_t>(other.high) + carry);
+        low = sum;
+        return *this;
+    }
+
+    friend Int128 operator+(Int128 left, const Int128& right)
+    {
+        return left += right;
+    }
+
+    Int128 operator-() const
+    {
+        Int128 negated;
+        negated.low = ~low + 1;
+        negated.high = static_cast<int64_t>(~static_cast<uint64_t>(high) + (negated.low == 0 ? 1 : 0));
+        return negated;
+    }
+
+    friend Int128 operator-(const Int128& left, const Int128& right)
+    {
+        return left + -right;
+    }
+
+    // Preconditions: 0 <= bits < 64
+    // Postconditions: Return the value times 2^bits, wrapped to 128 bits.
+    Int128 operator<<(unsigned bits) const
+    {
+        if (bits == 0)
+            return *this;
+        Int128 shifted;
+        shifted.high = static_cast<int64_t>((static_cast<uint64_t>(high) << bits) | (low >> (64 - bits)));
+        shifted.low = low << bits;
+        return shifted;
+    }
+
+    // Preconditions: None
+    // Postconditions: Return left * right wrapped to 128 bits, which is exact whenever the product fits.
+    friend Int128 operator*(const Int128& left, uint64_t right)
+    {
+        // Schoolbook product over 32-bit limbs; two's complement makes it right for a negative left too.
+        uint32_t x[4] = {static_cast<uint32_t>(left.low), static_cast<uint32_t>(left.low >> 32),
+                         static_cast<uint32_t>(left.high), static_cast<uint32_t>(static_cast<uint64_t>(left.high) >> 32)};
+        uint32_t y[2] = {static_cast<uint32_t>(right), static_cast<uint32_t>(right >> 32)};
+        uint32_t product[4] = {0, 0, 0, 0};
+        for (size_t i = 0; i < 2; i++)
+        {
+            uint64_t carry = 0;
+            for (size_t j = 0; i + j < 4; j++)
+            {
+                uint64_t term = static_cast<uint64_t>(x[j]) * y[i] + product[i + j] + carry;
+                product[i + j] = static_cast<uint32_t>(term);
+                carry = term >> 32;
+            }
+        }
+        Int128 result;
+        result.low = product[0] | static_cast<uint64_t>(product[1]) << 32;
+        result.high = static_cast<int64_t>(product[2] | static_cast<uint64_t>(product[3]) << 32);
+        return result;
+    }
+
+    friend bool operator==(const Int128&, const Int128&) = default;
+    friend strong_ordering operator<=>(const Int128&, const Int128&) = default;
+
+    // Preconditions: None
+    // Postconditions: Return the value rounded to double.
+    explicit operator double() const
+    {
+        const double twoTo64 = 18446744073709551616.0;
+        // Read as unsigned, the high word of the magnitude is right even for the lowest value.
+        Int128 magnitude = high < 0 ? -*this : *this;
+        double value = static_cast<double>(static_cast<uint64_t>(magnitude.high)) * twoTo64
+                       + static_cast<double>(magnitude.low);
+        return high < 0 ? -value : value;
+    }
+
+    // Preconditions: None
+    // Postconditions: Return the decimal digits of the value, with a leading '-' if negative.
+    string toString() const
+    {
+        bool negative = high < 0;
+        Int128 magnitude = negative ? -*this : *this;
+        uint32_t limbs[4] = {static_cast<uint32_t>(static_cast<uint64_t>(magnitude.high) >> 32),
+                             static_cast<uint32_t>(magnitude.high),
+                             static_cast<uint32_t>(magnitude.low >> 32), static_cast<uint32_t>(magnitude.low)};
+        string digits;
+        do
+        {
+            uint64_t remainder = 0;
+            for (auto& limb : limbs)
+            {
+                uint64_t current = remainder << 32 | limb;
+                limb = static_cast<uint32_t>(current / 10);
+                remainder = current % 10;
+            }
+            digits.push_back(static_cast<char>('0' + remainder));
+        } while (limbs[0] != 0 || limbs[1] != 0 || limbs[2] != 0 || limbs[3] != 0);
+        if (negative)
+            digits.push_back('-');
+        reverse(digits.begin(), digits.end());
+        return digits;
+    }
+
+private:
+    int64_t high;
+    uint64_t low;
+};
+
+// Preconditions: None
+// Postconditions: Return the decimal text of value, for the table columns that print wide strings.
+inline wstring to_wstring(const Int128& value)
+{
+    string digits = value.toString();
+    return wstring(digits.cbegin(), digits.cend());
+}
+
+#endif //PROJ1_INT128_H
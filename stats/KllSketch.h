@@ -0,0 +1,235 @@
+// Name : Long Duong
+// Date: 10/17/2026
+// Description: A KLL quantile sketch that answers rank and quantile queries over a stream in bounded memory.
+
+#ifndef PROJ1_KLLSKETCH_H
+#define PROJ1_KLLSKETCH_H
+
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <utility>
+#include "binaryIO.h"
+#include "../ui/configuration.h"
+#include "../ui/UIExcept.h"
+
+using namespace std;
+
+template <typename T>
+class KllSketch
+{
+public:
+    // Preconditions: k >= 8. Larger k means more memory and a smaller error.
+    // Postconditions: Instance describes an empty stream.
+    explicit KllSketch(size_t _k = config::QUANTILE_SKETCH_K) :
+        k {_k},
+        count {0},
+        levels(1),
+        random {0x5EED},
+        compacted {false},
+        retained {0},
+        capacity {levelCapacity(0)}
+    {}
+
+    // Preconditions: None
+    // Postconditions: value is part of the summarized stream.
+    void push(const T& value)
+    {
+        levels[0].push_back(value);
+        count++;
+        retained++;
+        sortedCache.clear();
+        if (retained > capacity)
+            compress();
+    }
+
+    // Preconditions: other was built with the same k.
+    // Postconditions: Instance summarizes both streams. Levels of equal weight are concatenated and then compacted
+    //                 back under capacity, so merges can be applied in any grouping.
+    void merge(const KllSketch& other)
+    {
+        if (other.k != k)
+            throw UIExcept("Cannot merge quantile sketches of different sizes");
+        while (levels.size() < other.levels.size())
+            levels.emplace_back();
+        for (size_t level = 0; level < other.levels.size(); level++)
+            levels[level].insert(levels[level].end(), other.levels[level].cbegin(), other.levels[level].cend());
+        count += other.count;
+        retained += other.retained;
+        compacted = compacted || other.compacted;
+        capacity = totalCapacity();
+        sortedCache.clear();
+        while (retained > capacity)
+            compress();
+    }
+
+    // Preconditions: None
+    // Postconditions: k, the count and every level are appended to out.
+    void writeTo(ostream& out) const
+    {
+        writeBinary(out, static_cast<uint64_t>(k));
+        writeBinary(out, count);
+        writeBinary(out, static_cast<uint8_t>(compacted));
+        writeBinary(out, static_cast<uint32_t>(levels.size()));
+        for (const auto& level : levels)
+        {
+            writeBinary(out, static_cast<uint64_t>(level.size()));
+            for (const auto& item : level)
+                writeBinary(out, item);
+        }
+    }
+
+    // Preconditions: in is positioned on data written by writeTo for the same T.
+    // Postconditions: Return the sketch read back or throw exception if the data is truncated or inconsistent.
+    static KllSketch readFrom(istream& in)
+    {
+        KllSketch sketch(static_cast<size_t>(readBinary<uint64_t>(in)));
+        sketch.count = readBinary<uint64_t>(in);
+        sketch.compacted = readBinary<uint8_t>(in) != 0;
+        uint32_t levelCount = readBinary<uint32_t>(in);
+        if (levelCount == 0 || levelCount > 64)
+            throw UIExcept("Invalid quantile sketch");
+        sketch.levels.assign(levelCount, vector<T>());
+        uint64_t weight = 0;
+        for (uint32_t level = 0; level < levelCount; level++)
+        {
+            uint64_t size = readBinary<uint64_t>(in);
+            if (size > sketch.count)
+                throw UIExcept("Invalid quantile sketch");
+            for (uint64_t i = 0; i < size; i++)
+                sketch.levels[level].push_back(readBinary<T>(in));
+            sketch.retained += static_cast<size_t>(size);
+            weight += size << level;
+        }
+        if (weight != sketch.count)
+            throw UIExcept("Invalid quantile sketch");
+        sketch.capacity = sketch.totalCapacity();
+        return sketch;
+    }
+
+    // Preconditions: None
+    // Postconditions: Return the number of values pushed.
+    uint64_t getCount() const
+    {
+        return count;
+    }
+
+    // Preconditions: None
+    // Postconditions: Return whether every value is still retained, in which case all answers are exact.
+    bool isExact() const
+    {
+        return !compacted;
+    }
+
+    // Preconditions: None
+    // Postconditions: Return the normalized rank error that holds with 99% confidence for a single query.
+    //                 For the default k = 200 it is about 1.3% of the stream length.
+    double getNormalizedRankError() const
+    {
+        return isExact() ? 0.0 : 2.296 / pow(static_cast<double>(k), 0.9723);
+    }
+
+    // Preconditions: rank < getCount()
+    // Postconditions: Return an estimate of the value that would sit at index rank of the sorted stream.
+    const T& valueAtRank(uint64_t rank) const
+    {
+        const auto& items = sortedItems();
+        uint64_t cumulative = 0;
+        for (const auto& item : items)
+        {
+            cumulative += item.second;
+            if (cumulative > rank)
+                return item.first;
+        }
+        return items.back().first;
+    }
+
+    // Preconditions: None
+    // Postconditions: Return an estimate of how many values of the stream are strictly less than value.
+    uint64_t rankOf(const T& value) const
+    {
+        uint64_t rank = 0;
+        for (const auto& item : sortedItems())
+        {
+            if (!(item.first < value))
+                break;
+            rank += item.second;
+        }
+        return rank;
+    }
+
+    // Preconditions: None
+    // Postconditions: Return the retained values in ascending order paired with the number of stream values
+    //                 each one stands for. The weights add up to getCount().
+    const vector<pair<T, uint64_t>>& sortedItems() const
+    {
+        if (sortedCache.empty() && count > 0)
+        {
+            for (size_t level = 0; level < levels.size(); level++)
+                for (const auto& item : levels[level])
+                    sortedCache.emplace_back(item, uint64_t(1) << level);
+            sort(sortedCache.begin(), sortedCache.end(),
+                 [](const auto& a, const auto& b) { return a.first < b.first; });
+        }
+        return sortedCache;
+    }
+
+private:
+    size_t k;
+    uint64_t count;
+    // levels[h] holds values that each stand for 2^h stream values.
+    vector<vector<T>> levels;
+    mt19937 random;
+    bool compacted;
+    // Number of values held by all levels and the sum of the level capacities.
+    size_t retained;
+    size_t capacity;
+    mutable vector<pair<T, uint64_t>> sortedCache;
+
+    // Lower levels get geometrically smaller capacities (factor 2/3), the top level gets k.
+    size_t levelCapacity(size_t level) const
+    {
+        size_t depth = levels.size() - 1 - level;
+        return max<size_t>(2, static_cast<size_t>(ceil(k * pow(2.0 / 3.0, static_cast<double>(depth)))));
+    }
+
+    size_t totalCapacity() const
+    {
+        size_t total = 0;
+        for (size_t level = 0; level < levels.size(); level++)
+            total += levelCapacity(level);
+        return total;
+    }
+
+    // Halve the lowest level that is over its capacity: sort it, then promote every other value (starting at a
+    // random offset) one level up with doubled weight.
+    void compress()
+    {
+        compacted = true;
+        for (size_t level = 0; level < levels.size(); level++)
+        {
+            if (levels[level].size() < levelCapacity(level))
+                continue;
+            if (level + 1 == levels.size())
+            {
+                levels.emplace_back();
+                capacity = totalCapacity();
+            }
+
+            auto& current = levels[level];
+            sort(current.begin(), current.end());
+            // With an odd count the smallest value stays behind so an even number is compacted.
+            size_t first = current.size() % 2;
+            size_t offset = random() & 1;
+            for (size_t i = first + offset; i < current.size(); i += 2)
+                levels[level + 1].push_back(current[i]);
+            retained -= (current.size() - first) / 2;
+            current.resize(first);
+            return;
+        }
+    }
+};
+
+#endif //PROJ1_KLLSKETCH_H
@@ -0,0 +1,108 @@
+// Name : Long Duong
+// Date: 10/17/2026
+// Description: Platform specific implementation of the read-only file mapping.
+
+#include "MappedFile.h"
+#include "../ui/UIExcept.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef _WIN32
+
+MappedFile::MappedFile(const std::string& path) :
+    data {nullptr},
+    length {0},
+    fileHandle {INVALID_HANDLE_VALUE},
+    mappingHandle {nullptr}
+{
+    fileHandle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                             OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (fileHandle == INVALID_HANDLE_VALUE)
+        throw UIExcept("Cannot open file");
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(fileHandle, &fileSize))
+    {
+        CloseHandle(fileHandle);
+        throw UIExcept("Cannot open file");
+    }
+    length = static_cast<std::size_t>(fileSize.QuadPart);
+    // An empty file cannot be mapped, but it is still a valid (empty) data file.
+    if (length == 0)
+        return;
+
+    mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mappingHandle == nullptr)
+    {
+        CloseHandle(fileHandle);
+        throw UIExcept("Cannot map file");
+    }
+    data = static_cast<const char*>(MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0));
+    if (data == nullptr)
+    {
+        CloseHandle(mappingHandle);
+        CloseHandle(fileHandle);
+        throw UIExcept("Cannot map file");
+    }
+}
+
+MappedFile::~MappedFile()
+{
+    if (data != nullptr)
+        UnmapViewOfFile(data);
+    if (mappingHandle != nullptr)
+        CloseHandle(mappingHandle);
+    if (fileHandle != INVALID_HANDLE_VALUE)
+        CloseHandle(fileHandle);
+}
+
+#else
+
+MappedFile::MappedFile(const std::string& path) :
+    data {nullptr},
+    length {0},
+    fileDescriptor {-1}
+{
+    fileDescriptor = open(path.c_str(), O_RDONLY);
+    if (fileDescriptor < 0)
+        throw UIExcept("Cannot open file");
+
+    struct stat fileStat {};
+    if (fstat(fileDescriptor, &fileStat) != 0 || !S_ISREG(fileStat.st_mode))
+    {
+        close(fileDescriptor);
+        throw UIExcept("Cannot open file");
+    }
+    length = static_cast<std::size_t>(fileStat.st_size);
+    // An empty file cannot be mapped, but it is still a valid (empty) data file.
+    if (length == 0)
+        return;
+
+    void* mapping = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+    if (mapping == MAP_FAILED)
+    {
+        close(fileDescriptor);
+        throw UIExcept("Cannot map file");
+    }
+    madvise(mapping, length, MADV_SEQUENTIAL);
+    data = static_cast<const char*>(mapping);
+}
+
+MappedFile::~MappedFile()
+{
+    if (data != nullptr)
+        munmap(const_cast<char*>(data), length);
+    if (fileDescriptor >= 0)
+        close(fileDescriptor);
+}
+
+#endif
@@ -0,0 +1,48 @@
+// Name : Long Duong
+// Date: 10/17/2026
+// Description: A read-only memory mapping of a whole file so the loaders can parse straight out of the page cache.
+
+#ifndef PROJ1_MAPPEDFILE_H
+#define PROJ1_MAPPEDFILE_H
+
+#include <string>
+#include <cstddef>
+
+class MappedFile
+{
+public:
+    // Preconditions: Expect a path to a readable regular file.
+    // Postconditions: The whole file is mapped read-only, or UIExcept is thrown if it cannot be opened or mapped.
+    explicit MappedFile(const std::string& path);
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    // Preconditions: None
+    // Postconditions: The mapping and the underlying file handles are released.
+    ~MappedFile();
+
+    // Preconditions: Instance was properly initialized.
+    // Postconditions: Return a pointer to the first byte of the file (nullptr for an empty file).
+    const char* begin() const { return data; }
+
+    // Preconditions: Instance was properly initialized.
+    // Postconditions: Return a pointer one past the last byte of the file.
+    const char* end() const { return data + length; }
+
+    // Preconditions: Instance was properly initialized.
+    // Postconditions: Return the size of the file in bytes.
+    std::size_t size() const { return length; }
+
+private:
+    const char* data;
+    std::size_t length;
+#ifdef _WIN32
+    void* fileHandle;
+    void* mappingHandle;
+#else
+    int fileDescriptor;
+#endif
+};
+
+#endif //PROJ1_MAPPEDFILE_H
@@ -0,0 +1,164 @@
+// Name : Long Duong
+// Date: 10/17/2026
+// Description: Numerically stable running central moments (Welford / Terriberry) shared by the statistics getters.
+
+#ifndef PROJ1_MOMENTS_H
+#define PROJ1_MOMENTS_H
+
+#include <cstddef>
+#include <cstdint>
+#include "binaryIO.h"
+
+class Moments
+{
+public:
+    // Preconditions: None
+    // Postconditions: Instance describes an empty sample.
+    Moments() = default;
+
+    // Preconditions: None
+    // Postconditions: x is folded into the count, mean and 2nd to 4th central moment sums.
+    void push(double x)
+    {
+        double previousCount = static_cast<double>(count);
+        count++;
+        double n = static_cast<double>(count);
+        double delta = x - mean;
+        double deltaOverN = delta / n;
+        double deltaOverNSquared = deltaOverN * deltaOverN;
+        double term = delta * deltaOverN * previousCount;
+
+        mean += deltaOverN;
+        M4 += term * deltaOverNSquared * (n * n - 3 * n + 3) + 6 * deltaOverNSquared * M2 - 4 * deltaOverN * M3;
+        M3 += term * deltaOverN * (n - 2) - 3 * deltaOverN * M2;
+        M2 += term;
+    }
+
+    // Preconditions: x is one of the values pushed or merged into this instance.
+    // Postconditions: x is taken back out by inverting the push update. Repeated removals accumulate the rounding
+    //                 of each step, so long lived instances should be rebuilt from the data now and then.
+    void remove(double x)
+    {
+        if (count <= 1)
+        {
+            *this = Moments();
+            return;
+        }
+        double n = static_cast<double>(count);
+        double previousMean = (n * mean - x) / (n - 1);
+        double delta = x - previousMean;
+        double deltaOverN = delta / n;
+        double deltaOverNSquared = deltaOverN * deltaOverN;
+        double term = delta * deltaOverN * (n - 1);
+
+        double previousM2 = M2 - term;
+        double previousM3 = M3 - term * deltaOverN * (n - 2) + 3 * deltaOverN * previousM2;
+        M4 = M4 - term * deltaOverNSquared * (n * n - 3 * n + 3) - 6 * deltaOverNSquared * previousM2
+             + 4 * deltaOverN * previousM3;
+        M3 = previousM3;
+        M2 = previousM2;
+        mean = previousMean;
+        count--;
+    }
+
+    // Preconditions: pivot is close to the mean of the n values and s1..s4 are the sums of the first four powers
+    //                 of their deviations from pivot.
+    // Postconditions: Return the moments of those n values, re-centered exactly on their mean.
+    static Moments fromShiftedSums(std::size_t n, double pivot, double s1, double s2, double s3, double s4)
+    {
+        Moments result;
+        if (n == 0)
+            return result;
+        double count = static_cast<double>(n);
+        double shift = s1 / count;
+        double shift2 = shift * shift;
+        result.count = n;
+        result.mean = pivot + shift;
+        result.M2 = s2 - count * shift2;
+        result.M3 = s3 - 3 * shift * s2 + 3 * shift2 * s1 - count * shift2 * shift;
+        result.M4 = s4 - 4 * shift * s3 + 6 * shift2 * s2 - 4 * shift2 * shift * s1 + count * shift2 * shift2;
+        return result;
+    }
+
+    // Preconditions: None
+    // Postconditions: Instance describes the union of both samples (Chan / Pebay pairwise update).
+    void merge(const Moments& other)
+    {
+        if (other.count == 0)
+            return;
+        if (count == 0)
+        {
+            *this = other;
+            return;
+        }
+        double na = static_cast<double>(count), nb = static_cast<double>(other.count);
+        double n = na + nb;
+        double delta = other.mean - mean;
+        double delta2 = delta * delta;
+
+        double mergedM4 = M4 + other.M4
+            + delta2 * delta2 * na * nb * (na * na - na * nb + nb * nb) / (n * n * n)
+            + 6 * delta2 * (na * na * other.M2 + nb * nb * M2) / (n * n)
+            + 4 * delta * (na * other.M3 - nb * M3) / n;
+        double mergedM3 = M3 + other.M3
+            + delta2 * delta * na * nb * (na - nb) / (n * n)
+            + 3 * delta * (na * other.M2 - nb * M2) / n;
+        double mergedM2 = M2 + other.M2 + delta2 * na * nb / n;
+
+        count += other.count;
+        mean += delta * nb / n;
+        M2 = mergedM2;
+        M3 = mergedM3;
+        M4 = mergedM4;
+    }
+
+    // Preconditions: None
+    // Postconditions: Return the number of values pushed.
+    std::size_t getCount() const { return count; }
+
+    // Preconditions: At least one value was pushed.
+    // Postconditions: Return the mean of the values pushed.
+    double getMean() const { return mean; }
+
+    // Preconditions: None
+    // Postconditions: Return the sum of squared deviations from the mean.
+    double getM2() const { return M2; }
+
+    // Preconditions: None
+    // Postconditions: Return the sum of cubed deviations from the mean.
+    double getM3() const { return M3; }
+
+    // Preconditions: None
+    // Postconditions: Return the sum of deviations from the mean raised to the fourth power.
+    double getM4() const { return M4; }
+
+    // Preconditions: None
+    // Postconditions: The count, mean and central moment sums are appended to out.
+    void writeTo(std::ostream& out) const
+    {
+        writeBinary(out, static_cast<std::uint64_t>(count));
+        writeBinary(out, mean);
+        writeBinary(out, M2);
+        writeBinary(out, M3);
+        writeBinary(out, M4);
+    }
+
+    // Preconditions: in is positioned on data written by writeTo.
+    // Postconditions: Return the moments read back or throw exception if in ends early.
+    static Moments readFrom(std::istream& in)
+    {
+        Moments result;
+        result.count = static_cast<std::size_t>(readBinary<std::uint64_t>(in));
+        result.mean = readBinary<double>(in);
+        result.M2 = readBinary<double>(in);
+        result.M3 = readBinary<double>(in);
+        result.M4 = readBinary<double>(in);
+        return result;
+    }
+
+private:
+    std::size_t count = 0;
+    double mean = 0, M2 = 0, M3 = 0, M4 = 0;
+};
+
+#endif //PROJ1_MOMENTS_H
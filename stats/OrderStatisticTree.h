@@ -0,0 +1,439 @@
+// Name : Long Duong
+// Date: 10/17/2026
+// Description: A treap of distinct values with counts that supports inserts, erases and rank queries in O(log n).
+
+#ifndef PROJ1_ORDERSTATISTICTREE_H
+#define PROJ1_ORDERSTATISTICTREE_H
+
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include "wideSum.h"
+
+using namespace std;
+
+// Every node holds one distinct value and how many times it occurs. Nodes are augmented with the number of values,
+// their exact sum and the largest count found in their subtree, which answers rank, prefix sum and mode queries on the
+// way down from the root. Nodes live in one vector and link by index; index 0 is an empty sentinel.
+template <typename T>
+class OrderStatisticTree
+{
+public:
+    // Preconditions: None
+    // Postconditions: Instance holds no value.
+    OrderStatisticTree() :
+        nodes(1),
+        root {NIL},
+        distinct {0},
+        randomState {0x9E3779B97F4A7C15ULL}
+    {}
+
+    // Preconditions: runs are (value, count) pairs with ascending distinct values and count > 0.
+    // Postconditions: The tree holds exactly the runs, built in O(runs) as a Cartesian tree on random priorities.
+    void assign(const vector<pair<T, uint64_t>>& runs)
+    {
+        clear();
+        nodes.reserve(runs.size() + 1);
+        vector<size_t> rightSpine;
+        for (const auto& run : runs)
+        {
+            size_t node = newNode(run.first, run.second);
+            size_t lastPopped = NIL;
+            while (!rightSpine.empty() && nodes[rightSpine.back()].priority < nodes[node].priority)
+            {
+                lastPopped = rightSpine.back();
+                rightSpine.pop_back();
+                update(lastPopped);
+            }
+            nodes[node].left = lastPopped;
+            if (!rightSpine.empty())
+                nodes[rightSpine.back()].right = node;
+            rightSpine.push_back(node);
+        }
+        while (!rightSpine.empty())
+        {
+            update(rightSpine.back());
+            rightSpine.pop_back();
+        }
+        root = runs.empty() ? NIL : findRoot();
+    }
+
+    // Preconditions: occurrences > 0
+    // Postconditions: value is counted occurrences more times.
+    void insert(const T& value, uint64_t occurrences = 1)
+    {
+        root = insertAt(root, value, occurrences);
+    }
+
+    // Preconditions: None
+    // Postconditions: Up to occurrences copies of value are removed. Return how many were removed.
+    uint64_t erase(const T& value, uint64_t occurrences = 1)
+    {
+        uint64_t removed = 0;
+        root = eraseAt(root, value, occurrences, removed);
+        return removed;
+    }
+
+    // Preconditions: None
+    // Postconditions: Instance holds no value.
+    void clear()
+    {
+        nodes.resize(1);
+        freeNodes.clear();
+        root = NIL;
+        distinct = 0;
+    }
+
+    // Preconditions: None
+    // Postconditions: Return the number of values, counting repeats.
+    uint64_t getCount() const
+    {
+        return nodes[root].subtreeCount;
+    }
+
+    // Preconditions: None
+    // Postconditions: Return the number of distinct values.
+    size_t getDistinctCount() const
+    {
+        return distinct;
+    }
+
+    // Preconditions: None
+    // Postconditions: Return the sum of all values.
+    WideSumType<T> getSum() const
+    {
+        return nodes[root].subtreeSum;
+    }
+
+    // Preconditions: getCount() > 0
+    // Postconditions: Return the smallest and the largest value.
+    const T& getMin() const
+    {
+        size_t node = root;
+        while (nodes[node].left != NIL)
+            node = nodes[node].left;
+        return nodes[node].value;
+    }
+
+    const T& getMax() const
+    {
+        size_t node = root;
+        while (nodes[node].right != NIL)
+            node = nodes[node].right;
+        return nodes[node].value;
+    }
+
+    // Preconditions: rank < getCount()
+    // Postconditions: Return the value at index rank of the sorted values.
+    const T& valueAtRank(uint64_t rank) const
+    {
+        size_t node = root;
+        while (true)
+        {
+            uint64_t leftCount = nodes[nodes[node].left].subtreeCount;
+            if (rank < leftCount)
+                node = nodes[node].left;
+            else if (rank < leftCount + nodes[node].count)
+                return nodes[node].value;
+            else
+            {
+                rank -= leftCount + nodes[node].count;
+                node = nodes[node].right;
+            }
+        }
+    }
+
+    // Preconditions: bound is comparable with T, e.g. a double fence against integer values.
+    // Postconditions: Return how many values are strictly below bound, or at most bound, and their sum.
+    template <typename Bound>
+    pair<uint64_t, WideSumType<T>> countAndSumBelow(const Bound& bound) const
+    {
+        return prefixOf([&bound](const T& value) { return value < bound; });
+    }
+
+    template <typename Bound>
+    pair<uint64_t, WideSumType<T>> countAndSumAtOrBelow(const Bound& bound) const
+    {
+        return prefixOf([&bound](const T& value) { return !(bound < value); });
+    }
+
+    // Preconditions: None
+    // Postconditions: Return how many times value occurs.
+    uint64_t countOf(const T& value) const
+    {
+        size_t node = root;
+        while (node != NIL)
+        {
+            if (value < nodes[node].value)
+                node = nodes[node].left;
+            else if (nodes[node].value < value)
+                node = nodes[node].right;
+            else
+                return nodes[node].count;
+        }
+        return 0;
+    }
+
+    // Preconditions: None
+    // Postconditions: Return the largest count of any value.
+    uint64_t getMaxCount() const
+    {
+        return nodes[root].subtreeMaxCount;
+    }
+
+    // Preconditions: None
+    // Postconditions: Return every value occurring getMaxCount() times in ascending order. Subtrees without such a
+    //                 value are skipped, so this costs O(modes * log n).
+    vector<T> getModes() const
+    {
+        vector<T> modes;
+        if (root != NIL)
+            collectModes(root, nodes[root].subtreeMaxCount, modes);
+        return modes;
+    }
+
+    // Preconditions: visit is callable with (const T& value, uint64_t count).
+    // Postconditions: visit is called for every distinct value in ascending order.
+    template <typename Visit>
+    void forEach(Visit&& visit) const
+    {
+        visitRange(root, [](const T&) { return true; }, [](const T&) { return true; }, visit);
+    }
+
+    // Preconditions: visit is callable with (const T& value, uint64_t count) and bound is comparable with T.
+    // Postconditions: visit is called in ascending order for every distinct value strictly below bound, or strictly
+    //                 above it, skipping the subtrees outside the range.
+    template <typename Bound, typename Visit>
+    void forEachBelow(const Bound& bound, Visit&& visit) const
+    {
+        visitRange(root, [](const T&) { return true; }, [&bound](const T& value) { return value < bound; }, visit);
+    }
+
+    template <typename Bound, typename Visit>
+    void forEachAbove(const Bound& bound, Visit&& visit) const
+    {
+        visitRange(root, [&bound](const T& value) { return bound < value; }, [](const T&) { return true; }, visit);
+    }
+
+private:
+    struct Node
+    {
+        T value {};
+        uint64_t count = 0;
+        uint64_t subtreeCount = 0;
+        WideSumType<T> subtreeSum {};
+        uint64_t subtreeMaxCount = 0;
+        uint64_t priority = 0;
+        size_t left = 0;
+        size_t right = 0;
+    };
+
+    static constexpr size_t NIL = 0;
+
+    vector<Node> nodes;
+    vector<size_t> freeNodes;
+    size_t root;
+    size_t distinct;
+    uint64_t randomState;
+
+    // xorshift64, enough to keep the treap balanced in expectation.
+    uint64_t nextPriority()
+    {
+        randomState ^= randomState << 13;
+        randomState ^= randomState >> 7;
+        randomState ^= randomState << 17;
+        return randomState;
+    }
+
+    size_t newNode(const T& value, uint64_t occurrences)
+    {
+        Node node;
+        node.value = value;
+        node.count = occurrences;
+        node.priority = nextPriority();
+        size_t index;
+        if (!freeNodes.empty())
+        {
+            index = freeNodes.back();
+            freeNodes.pop_back();
+            nodes[index] = node;
+        }
+        else
+        {
+            index = nodes.size();
+            nodes.push_back(node);
+        }
+        distinct++;
+        update(index);
+        return index;
+    }
+
+    void freeNode(size_t node)
+    {
+        freeNodes.push_back(node);
+        distinct--;
+    }
+
+    // The value times its count, which cannot overflow for integers: the sum is 128 bits wide.
+    static WideSumType<T> weightedValue(const Node& node)
+    {
+        return WideSumType<T>(node.value) * node.count;
+    }
+
+    void update(size_t node)
+    {
+        Node& current = nodes[node];
+        const Node& left = nodes[current.left];
+        const Node& right = nodes[current.right];
+        current.subtreeCount = left.subtreeCount + current.count + right.subtreeCount;
+        current.subtreeSum = left.subtreeSum + weightedValue(current) + right.subtreeSum;
+        current.subtreeMaxCount = max({left.subtreeMaxCount, current.count, right.subtreeMaxCount});
+    }
+
+    size_t findRoot() const
+    {
+        size_t best = 1;
+        for (size_t node = 2; node < nodes.size(); node++)
+            if (nodes[node].priority > nodes[best].priority)
+                best = node;
+        return best;
+    }
+
+    size_t rotateRight(size_t node)
+    {
+        size_t pivot = nodes[node].left;
+        nodes[node].left = nodes[pivot].right;
+        nodes[pivot].right = node;
+        update(node);
+        update(pivot);
+        return pivot;
+    }
+
+    size_t rotateLeft(size_t node)
+    {
+        size_t pivot = nodes[node].right;
+        nodes[node].right = nodes[pivot].left;
+        nodes[pivot].left = node;
+        update(node);
+        update(pivot);
+        return pivot;
+    }
+
+    size_t insertAt(size_t node, const T& value, uint64_t occurrences)
+    {
+        if (node == NIL)
+            return newNode(value, occurrences);
+        if (value < nodes[node].value)
+        {
+            size_t child = insertAt(nodes[node].left, value, occurrences);
+            nodes[node].left = child;
+            if (nodes[child].priority > nodes[node].priority)
+                return rotateRight(node);
+        }
+        else if (nodes[node].value < value)
+        {
+            size_t child = insertAt(nodes[node].right, value, occurrences);
+            nodes[node].right = child;
+            if (nodes[child].priority > nodes[node].priority)
+                return rotateLeft(node);
+        }
+        else
+            nodes[node].count += occurrences;
+        update(node);
+        return node;
+    }
+
+    size_t eraseAt(size_t node, const T& value, uint64_t occurrences, uint64_t& removed)
+    {
+        if (node == NIL)
+            return NIL;
+        if (value < nodes[node].value)
+            nodes[node].left = eraseAt(nodes[node].left, value, occurrences, removed);
+        else if (nodes[node].value < value)
+            nodes[node].right = eraseAt(nodes[node].right, value, occurrences, removed);
+        else
+        {
+            removed = min(occurrences, nodes[node].count);
+            nodes[node].count -= removed;
+            if (nodes[node].count == 0)
+            {
+                size_t replacement = join(nodes[node].left, nodes[node].right);
+                freeNode(node);
+                return replacement;
+            }
+        }
+        update(node);
+        return node;
+    }
+
+    // Preconditions: Every value of left is below every value of right.
+    // Postconditions: Return the root of one treap holding both.
+    size_t join(size_t left, size_t right)
+    {
+        if (left == NIL)
+            return right;
+        if (right == NIL)
+            return left;
+        if (nodes[left].priority > nodes[right].priority)
+        {
+            nodes[left].right = join(nodes[left].right, right);
+            update(left);
+            return left;
+        }
+        nodes[right].left = join(left, nodes[right].left);
+        update(right);
+        return right;
+    }
+
+    void collectModes(size_t node, uint64_t maxCount, vector<T>& modes) const
+    {
+        if (node == NIL || nodes[node].subtreeMaxCount < maxCount)
+            return;
+        collectModes(nodes[node].left, maxCount, modes);
+        if (nodes[node].count == maxCount)
+            modes.push_back(nodes[node].value);
+        collectModes(nodes[node].right, maxCount, modes);
+    }
+
+    // Walks down to the boundary of the values satisfying inPrefix, which must hold for a prefix of the order.
+    template <typename InPrefix>
+    pair<uint64_t, WideSumType<T>> prefixOf(InPrefix inPrefix) const
+    {
+        uint64_t count = 0;
+        WideSumType<T> sum {};
+        size_t node = root;
+        while (node != NIL)
+        {
+            if (inPrefix(nodes[node].value))
+            {
+                const Node& left = nodes[nodes[node].left];
+                count += left.subtreeCount + nodes[node].count;
+                sum += left.subtreeSum + weightedValue(nodes[node]);
+                node = nodes[node].right;
+            }
+            else
+                node = nodes[node].left;
+        }
+        return {count, sum};
+    }
+
+    // Visits the values v of the subtree with aboveLower(v) and belowUpper(v), both monotone in v.
+    template <typename AboveLower, typename BelowUpper, typename Visit>
+    void visitRange(size_t node, const AboveLower& aboveLower, const BelowUpper& belowUpper, Visit& visit) const
+    {
+        if (node == NIL)
+            return;
+        const Node& current = nodes[node];
+        bool isAboveLower = aboveLower(current.value);
+        bool isBelowUpper = belowUpper(current.value);
+        if (isAboveLower)
+            visitRange(current.left, aboveLower, belowUpper, visit);
+        if (isAboveLower && isBelowUpper)
+            visit(current.value, current.count);
+        if (isBelowUpper)
+            visitRange(current.right, aboveLower, belowUpper, visit);
+    }
+};
+
+#endif //PROJ1_ORDERSTATISTICTREE_H
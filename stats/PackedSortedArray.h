@@ -0,0 +1,245 @@
+// Name : Long Duong
+// Date: 10/17/2026
+// Description: A read-only sorted integer array stored as bit-packed offsets in fixed-size blocks.
+
+#ifndef PROJ1_PACKEDSORTEDARRAY_H
+#define PROJ1_PACKEDSORTEDARRAY_H
+
+#include <vector>
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <type_traits>
+#include "parallel.h"
+
+using namespace std;
+
+// Values are cut into blocks of BLOCK_SIZE. The skip index keeps the first value of every block and where its bits
+// start; each value of the block is stored as its offset from that first value in just enough bits for the largest
+// offset of the block. Sorted data has small offsets, and a block of repeats needs 0 bits. Blocks start on a word
+// boundary so they are packed and decoded independently, and value i is read in O(1) from its block header.
+template <typename T>
+class PackedSortedArray
+{
+public:
+    static_assert(is_integral_v<T>, "only integer values are bit-packed");
+    static constexpr size_t BLOCK_SIZE = 128;
+
+    PackedSortedArray() :
+        count {0}
+    {}
+
+    // Preconditions: data points to n values in ascending order.
+    // Postconditions: Instance holds the values, blocks packed in parallel.
+    PackedSortedArray(const T* data, size_t n) :
+        count {n}
+    {
+        size_t blockCount = (n + BLOCK_SIZE - 1) / BLOCK_SIZE;
+        blocks.resize(blockCount);
+        uint64_t wordOffset = 0;
+        for (size_t block = 0; block < blockCount; block++)
+        {
+            size_t first = block * BLOCK_SIZE;
+            size_t length = min(BLOCK_SIZE, n - first);
+            blocks[block].base = data[first];
+            blocks[block].width = static_cast<uint8_t>(bit_width(offsetOf(data[first + length - 1], data[first])));
+            blocks[block].wordOffset = wordOffset;
+            wordOffset += wordsFor(length, blocks[block].width);
+        }
+        words.assign(wordOffset, 0);
+        parallelFor((blockCount + BLOCKS_PER_TASK - 1) / BLOCKS_PER_TASK, [&](size_t task)
+        {
+            for (size_t block = task * BLOCKS_PER_TASK; block < min(blockCount, (task + 1) * BLOCKS_PER_TASK); block++)
+                packBlock(block, data + block * BLOCK_SIZE, min(BLOCK_SIZE, n - block * BLOCK_SIZE));
+        });
+    }
+
+    // Preconditions: value is not below the last value added.
+    // Postconditions: value is appended, so a sorted stream can be packed without holding it in memory.
+    void push_back(const T& value)
+    {
+        pending.push_back(value);
+        count++;
+        if (pending.size() == BLOCK_SIZE)
+            flushPending();
+    }
+
+    // Preconditions: None
+    // Postconditions: A partial last block added by push_back is packed. Must be called before reading values added
+    //                 by push_back.
+    void finish()
+    {
+        if (!pending.empty())
+            flushPending();
+        vector<T>().swap(pending);
+        words.shrink_to_fit();
+        blocks.shrink_to_fit();
+    }
+
+    // Preconditions: None
+    // Postconditions: Return the number of values.
+    size_t size() const
+    {
+        return count;
+    }
+
+    // Preconditions: i < size()
+    // Postconditions: Return the value at index i in O(1).
+    T operator[](size_t i) const
+    {
+        const BlockHeader& header = blocks[i / BLOCK_SIZE];
+        return fromOffset(header.base, readBits(header, i % BLOCK_SIZE));
+    }
+
+    // Preconditions: None
+    // Postconditions: Return the number of blocks.
+    size_t getBlockCount() const
+    {
+        return blocks.size();
+    }
+
+    // Preconditions: block < getBlockCount() and out has room for BLOCK_SIZE values.
+    // Postconditions: The values of the block are written to out. Return how many.
+    size_t decodeBlock(size_t block, T* out) const
+    {
+        const BlockHeader& header = blocks[block];
+        size_t length = min(BLOCK_SIZE, count - block * BLOCK_SIZE);
+        if (header.width == 0)
+        {
+            fill(out, out + length, header.base);
+            return length;
+        }
+        const uint64_t* source = words.data() + header.wordOffset;
+        uint64_t mask = header.width == 64 ? ~uint64_t(0) : (uint64_t(1) << header.width) - 1;
+        uint64_t bitPosition = 0;
+        for (size_t k = 0; k < length; k++, bitPosition += header.width)
+        {
+            uint64_t word = bitPosition / 64, shift = bitPosition % 64;
+            uint64_t bits = source[word] >> shift;
+            if (shift + header.width > 64)
+                bits |= source[word + 1] << (64 - shift);
+            out[k] = fromOffset(header.base, bits & mask);
+        }
+        return length;
+    }
+
+    // Preconditions: bound is comparable with T.
+    // Postconditions: Return the index of the first value not below bound, or not at most bound, like
+    //                 lower_bound and upper_bound. The skip index narrows the search to one block.
+    template <typename Bound>
+    size_t lowerBound(const Bound& bound) const
+    {
+        return partitionPoint([&bound](const T& value) { return value < bound; });
+    }
+
+    template <typename Bound>
+    size_t upperBound(const Bound& bound) const
+    {
+        return partitionPoint([&bound](const T& value) { return !(bound < value); });
+    }
+
+    // Preconditions: None
+    // Postconditions: Return the bytes used by the packed words and the skip index.
+    size_t memoryBytes() const
+    {
+        return words.capacity() * sizeof(uint64_t) + blocks.capacity() * sizeof(BlockHeader);
+    }
+
+private:
+    struct BlockHeader
+    {
+        T base;
+        uint8_t width;
+        uint64_t wordOffset;
+    };
+
+    static constexpr size_t BLOCKS_PER_TASK = 1024;
+
+    using Unsigned = make_unsigned_t<T>;
+
+    vector<BlockHeader> blocks;
+    vector<uint64_t> words;
+    vector<T> pending;
+    size_t count;
+
+    static uint64_t offsetOf(const T& value, const T& base)
+    {
+        return static_cast<uint64_t>(static_cast<Unsigned>(static_cast<Unsigned>(value) - static_cast<Unsigned>(base)));
+    }
+
+    static T fromOffset(const T& base, uint64_t offset)
+    {
+        return static_cast<T>(static_cast<Unsigned>(static_cast<Unsigned>(base) + static_cast<Unsigned>(offset)));
+    }
+
+    static uint64_t wordsFor(size_t length, unsigned width)
+    {
+        return (static_cast<uint64_t>(length) * width + 63) / 64;
+    }
+
+    uint64_t readBits(const BlockHeader& header, size_t k) const
+    {
+        if (header.width == 0)
+            return 0;
+        uint64_t bitPosition = static_cast<uint64_t>(k) * header.width;
+        const uint64_t* source = words.data() + header.wordOffset + bitPosition / 64;
+        uint64_t shift = bitPosition % 64;
+        uint64_t bits = source[0] >> shift;
+        if (shift + header.width > 64)
+            bits |= source[1] << (64 - shift);
+        return header.width == 64 ? bits : bits & ((uint64_t(1) << header.width) - 1);
+    }
+
+    void packBlock(size_t block, const T* data, size_t length)
+    {
+        const BlockHeader& header = blocks[block];
+        if (header.width == 0)
+            return;
+        uint64_t* target = words.data() + header.wordOffset;
+        uint64_t bitPosition = 0;
+        for (size_t k = 0; k < length; k++, bitPosition += header.width)
+        {
+            uint64_t offset = offsetOf(data[k], header.base);
+            uint64_t word = bitPosition / 64, shift = bitPosition % 64;
+            target[word] |= offset << shift;
+            if (shift + header.width > 64)
+                target[word + 1] |= offset >> (64 - shift);
+        }
+    }
+
+    void flushPending()
+    {
+        BlockHeader header {};
+        header.base = pending.front();
+        header.width = static_cast<uint8_t>(bit_width(offsetOf(pending.back(), pending.front())));
+        header.wordOffset = words.size();
+        blocks.push_back(header);
+        words.resize(words.size() + wordsFor(pending.size(), header.width), 0);
+        packBlock(blocks.size() - 1, pending.data(), pending.size());
+        pending.clear();
+    }
+
+    // Index of the first value for which inPrefix is false, inPrefix holding for a prefix of the values.
+    template <typename InPrefix>
+    size_t partitionPoint(InPrefix inPrefix) const
+    {
+        // The last block whose first value is in the prefix holds the boundary, unless the boundary is its end.
+        auto block = partition_point(blocks.cbegin(), blocks.cend(),
+                                     [&inPrefix](const BlockHeader& header) { return inPrefix(header.base); });
+        if (block == blocks.cbegin())
+            return 0;
+        size_t first = static_cast<size_t>(std::distance(blocks.cbegin(), block) - 1) * BLOCK_SIZE;
+        size_t last = min(count, first + BLOCK_SIZE);
+        while (first < last)
+        {
+            size_t middle = first + (last - first) / 2;
+            if (inPrefix((*this)[middle]))
+                first = middle + 1;
+            else
+                last = middle;
+        }
+        return first;
+    }
+};
+
+#endif //PROJ1_PACKEDSORTEDARRAY_H
@@ -0,0 +1,261 @@
+// Name : Long Duong
+// Date: 10/17/2026
+// Description: A mergeable, serializable summary of one shard of data that finalizes into the statistics getters.
+
+#ifndef PROJ1_PARTIALAGGREGATE_H
+#define PROJ1_PARTIALAGGREGATE_H
+
+#include <vector>
+#include <queue>
+#include <string>
+#include <fstream>
+#include <algorithm>
+#include <functional>
+#include <cstdint>
+#include <type_traits>
+#include "binaryIO.h"
+#include "parallel.h"
+#include "Moments.h"
+#include "KllSketch.h"
+#include "FrequencySketch.h"
+#include "wideSum.h"
+#include "../ui/configuration.h"
+#include "../ui/UIExcept.h"
+
+using namespace std;
+
+// Holds count, sum, min, max, moments, a quantile sketch, a frequency sketch and the most extreme values of a
+// shard. merge() is associative, so shards can be combined in any tree across threads, files or machines.
+template <typename T>
+class PartialAggregate
+{
+public:
+    // Preconditions: None
+    // Postconditions: Instance describes an empty shard.
+    PartialAggregate() = default;
+
+    // Preconditions: data points to n values.
+    // Postconditions: Return the aggregate of the values, built per reduction block on the shared pool and merged.
+    static PartialAggregate fromValues(const T* data, size_t n)
+    {
+        return parallelReduce(
+            n, PartialAggregate(),
+            [data](size_t first, size_t last)
+            {
+                PartialAggregate partial;
+                for (size_t i = first; i < last; i++)
+                    partial.push(data[i]);
+                return partial;
+            },
+            [](PartialAggregate left, const PartialAggregate& right) { left.merge(right); return left; }
+        );
+    }
+
+    // Preconditions: None
+    // Postconditions: value is folded into every summary.
+    void push(const T& value)
+    {
+        if (count == 0 || value < minimum)
+            minimum = value;
+        if (count == 0 || maximum < value)
+            maximum = value;
+        count++;
+        sum.add(value);
+        moments.push(static_cast<double>(value));
+        quantiles.push(value);
+        frequencies.push(value);
+        keepExtreme(smallestValues, value);
+        keepExtreme(largestValues, value);
+    }
+
+    // Preconditions: None
+    // Postconditions: Instance summarizes the union of both shards.
+    void merge(const PartialAggregate& other)
+    {
+        if (other.count == 0)
+            return;
+        if (count == 0 || other.minimum < minimum)
+            minimum = other.minimum;
+        if (count == 0 || maximum < other.maximum)
+            maximum = other.maximum;
+        count += other.count;
+        sum.merge(other.sum);
+        moments.merge(other.moments);
+        quantiles.merge(other.quantiles);
+        frequencies.merge(other.frequencies);
+        for (const auto& value : sortedExtremes(other.smallestValues))
+            keepExtreme(smallestValues, value);
+        for (const auto& value : sortedExtremes(other.largestValues))
+            keepExtreme(largestValues, value);
+    }
+
+    // Preconditions: None
+    // Postconditions: The aggregate is appended to out: a "PAGG" magic, the format version, the value type tag and
+    //                 then every summary.
+    void writeTo(ostream& out) const
+    {
+        out.write(MAGIC, sizeof(MAGIC));
+        writeBinary(out, FORMAT_VERSION);
+        writeBinary(out, valueKind());
+        writeBinary(out, static_cast<uint8_t>(sizeof(T)));
+        writeBinary(out, count);
+        writeBinary(out, minimum);
+        writeBinary(out, maximum);
+        sum.writeTo(out);
+        moments.writeTo(out);
+        quantiles.writeTo(out);
+        frequencies.writeTo(out);
+        writeExtremes(out, smallestValues);
+        writeExtremes(out, largestValues);
+    }
+
+    // Preconditions: in is positioned on data written by writeTo.
+    // Postconditions: Return the aggregate read back or throw exception if the magic, version or value type do not
+    //                 match or the data is truncated.
+    static PartialAggregate readFrom(istream& in)
+    {
+        char magic[sizeof(MAGIC)];
+        if (!in.read(magic, sizeof(magic)) || !equal(begin(magic), end(magic), MAGIC))
+            throw UIExcept("Not a partial aggregate");
+        if (readBinary<uint16_t>(in) != FORMAT_VERSION)
+            throw UIExcept("Unsupported partial aggregate version");
+        if (readBinary<uint8_t>(in) != valueKind() || readBinary<uint8_t>(in) != sizeof(T))
+            throw UIExcept("Partial aggregate holds a different value type");
+
+        PartialAggregate aggregate;
+        aggregate.count = readBinary<uint64_t>(in);
+        aggregate.minimum = readBinary<T>(in);
+        aggregate.maximum = readBinary<T>(in);
+        aggregate.sum = WideAccumulator<T>::readFrom(in);
+        aggregate.moments = Moments::readFrom(in);
+        aggregate.quantiles = KllSketch<T>::readFrom(in);
+        aggregate.frequencies = FrequencySketch<T>::readFrom(in);
+        readExtremes(in, aggregate.smallestValues);
+        readExtremes(in, aggregate.largestValues);
+        if (aggregate.quantiles.getCount() != aggregate.count || aggregate.moments.getCount() != aggregate.count)
+            throw UIExcept("Invalid partial aggregate");
+        return aggregate;
+    }
+
+    // Preconditions: A path to a writable file
+    // Postconditions: The aggregate is written to the file or throw exception if file cannot be opened.
+    void writeToFile(const string& path) const
+    {
+        ofstream out(path, ios::out | ios::binary);
+        if (!out.is_open())
+            throw UIExcept("Cannot open file");
+        writeTo(out);
+    }
+
+    // Preconditions: A path to a file written by writeToFile
+    // Postconditions: Return the aggregate or throw exception if file cannot be opened or is not valid.
+    static PartialAggregate readFromFile(const string& path)
+    {
+        ifstream in(path, ios::in | ios::binary);
+        if (!in.is_open())
+            throw UIExcept("Cannot open file");
+        return readFrom(in);
+    }
+
+    // Preconditions: None
+    // Postconditions: Return the number of values summarized.
+    uint64_t getCount() const { return count; }
+
+    // Preconditions: getCount() > 0
+    // Postconditions: Return the minimum and the maximum.
+    const T& getMin() const { return minimum; }
+    const T& getMax() const { return maximum; }
+
+    // Preconditions: None
+    // Postconditions: Return the sum, exact for integers and compensated for floating values.
+    WideSumType<T> getSum() const { return sum.value(); }
+
+    // Preconditions: None
+    // Postconditions: Return the exact moments.
+    const Moments& getMoments() const { return moments; }
+
+    // Preconditions: None
+    // Postconditions: Return the quantile sketch.
+    const KllSketch<T>& getQuantiles() const { return quantiles; }
+
+    // Preconditions: None
+    // Postconditions: Return the frequency sketch.
+    const FrequencySketch<T>& getFrequencies() const { return frequencies; }
+
+    // Preconditions: None
+    // Postconditions: Return up to config::STREAMING_EXTREME_CAPACITY of the smallest or largest values, ascending.
+    vector<T> getSmallestValues() const { return sortedExtremes(smallestValues); }
+    vector<T> getLargestValues() const { return sortedExtremes(largestValues); }
+
+private:
+    // Max-heap of the smallest values and min-heap of the largest values.
+    using SmallestHeap = priority_queue<T, vector<T>, less<T>>;
+    using LargestHeap = priority_queue<T, vector<T>, greater<T>>;
+
+    static constexpr char MAGIC[4] = {'P', 'A', 'G', 'G'};
+    // Version 2 widened the sum to a 128-bit integer, or a compensated pair for floating values.
+    static constexpr uint16_t FORMAT_VERSION = 2;
+
+    uint64_t count = 0;
+    T minimum {};
+    T maximum {};
+    WideAccumulator<T> sum;
+    Moments moments;
+    KllSketch<T> quantiles;
+    FrequencySketch<T> frequencies;
+    SmallestHeap smallestValues;
+    LargestHeap largestValues;
+
+    // 0 for signed integers, 1 for unsigned integers and 2 for floating point values.
+    static uint8_t valueKind()
+    {
+        return is_floating_point_v<T> ? 2 : (is_signed_v<T> ? 0 : 1);
+    }
+
+    // Keep value if it is among the config::STREAMING_EXTREME_CAPACITY most extreme values seen by heap.
+    template <typename Heap>
+    static void keepExtreme(Heap& heap, const T& value)
+    {
+        if (heap.size() < static_cast<size_t>(config::STREAMING_EXTREME_CAPACITY))
+            heap.push(value);
+        else if (typename Heap::value_compare()(value, heap.top()))
+        {
+            heap.pop();
+            heap.push(value);
+        }
+    }
+
+    template <typename Heap>
+    static vector<T> sortedExtremes(Heap heap)
+    {
+        vector<T> values;
+        while (!heap.empty())
+        {
+            values.push_back(heap.top());
+            heap.pop();
+        }
+        sort(values.begin(), values.end());
+        return values;
+    }
+
+    template <typename Heap>
+    static void writeExtremes(ostream& out, const Heap& heap)
+    {
+        auto values = sortedExtremes(heap);
+        writeBinary(out, static_cast<uint64_t>(values.size()));
+        for (const auto& value : values)
+            writeBinary(out, value);
+    }
+
+    template <typename Heap>
+    static void readExtremes(istream& in, Heap& heap)
+    {
+        uint64_t size = readBinary<uint64_t>(in);
+        if (size > static_cast<uint64_t>(config::STREAMING_EXTREME_CAPACITY))
+            throw UIExcept("Invalid partial aggregate");
+        for (uint64_t i = 0; i < size; i++)
+            heap.push(readBinary<T>(in));
+    }
+};
+
+#endif //PROJ1_PARTIALAGGREGATE_H
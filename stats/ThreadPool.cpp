@@ -0,0 +1,97 @@
+// Name : Long Duong
+// Date: 10/17/2026
+// Description: Implements the worker loop and job hand-out of ThreadPool.
+
+#include "ThreadPool.h"
+
+ThreadPool::ThreadPool(std::size_t threadCount) :
+    stopping {false}
+{
+    for (std::size_t i = 1; i < threadCount; i++)
+        workers.emplace_back(&ThreadPool::workerLoop, this);
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        stopping = true;
+    }
+    jobAvailable.notify_all();
+    for (auto& worker : workers)
+        worker.join();
+}
+
+void ThreadPool::run(std::size_t taskCount, const std::function<void(std::size_t)>& task)
+{
+    if (taskCount == 0)
+        return;
+
+    auto job = std::make_shared<Job>();
+    job->task = &task;
+    job->taskCount = taskCount;
+    if (taskCount > 1 && !workers.empty())
+    {
+        {
+            std::lock_guard<std::mutex> lock(queueMutex);
+            pendingJobs.push_back(job);
+        }
+        jobAvailable.notify_all();
+    }
+
+    work(*job);
+    {
+        std::unique_lock<std::mutex> lock(queueMutex);
+        jobFinished.wait(lock, [&job]() { return job->finishedTasks.load() == job->taskCount; });
+    }
+    if (job->error)
+        std::rethrow_exception(job->error);
+}
+
+bool ThreadPool::work(Job& job)
+{
+    std::size_t finishedHere = 0;
+    std::size_t index;
+    while ((index = job.nextTask.fetch_add(1)) < job.taskCount)
+    {
+        try
+        {
+            (*job.task)(index);
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(job.errorMutex);
+            if (!job.error)
+                job.error = std::current_exception();
+        }
+        finishedHere++;
+    }
+    return finishedHere > 0 && job.finishedTasks.fetch_add(finishedHere) + finishedHere == job.taskCount;
+}
+
+void ThreadPool::workerLoop()
+{
+    while (true)
+    {
+        std::shared_ptr<Job> job;
+        {
+            std::unique_lock<std::mutex> lock(queueMutex);
+            jobAvailable.wait(lock, [this]() { return stopping || !pendingJobs.empty(); });
+            if (stopping)
+                return;
+            job = pendingJobs.front();
+            // Every index is claimed, the remaining work belongs to threads already running it.
+            if (job->nextTask.load() >= job->taskCount)
+            {
+                pendingJobs.pop_front();
+                continue;
+            }
+        }
+        if (work(*job))
+        {
+            // Taking the lock orders the notification after the waiter's predicate check.
+            std::lock_guard<std::mutex> lock(queueMutex);
+            jobFinished.notify_all();
+        }
+    }
+}
@@ -0,0 +1,66 @@
+// Name : Long Duong
+// Date: 10/17/2026
+// Description: A persistent pool of worker threads that hand out the tasks of a job through an atomic counter.
+
+#ifndef PROJ1_THREADPOOL_H
+#define PROJ1_THREADPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class ThreadPool
+{
+public:
+    // Preconditions: None
+    // Postconditions: threadCount - 1 workers are started; the thread calling run() is the last worker.
+    explicit ThreadPool(std::size_t threadCount);
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // Preconditions: No job is running.
+    // Postconditions: All workers are stopped and joined.
+    ~ThreadPool();
+
+    // Preconditions: task is callable with an index in [0, taskCount).
+    // Postconditions: Every task ran exactly once. Idle workers and the calling thread keep taking the next
+    //                 unclaimed index, so uneven tasks balance themselves. The first exception thrown is rethrown.
+    void run(std::size_t taskCount, const std::function<void(std::size_t)>& task);
+
+    // Preconditions: None
+    // Postconditions: Return the number of threads that execute tasks, including the caller.
+    std::size_t getThreadCount() const { return workers.size() + 1; }
+
+private:
+    struct Job
+    {
+        const std::function<void(std::size_t)>* task;
+        std::size_t taskCount;
+        std::atomic<std::size_t> nextTask {0};
+        std::atomic<std::size_t> finishedTasks {0};
+        std::exception_ptr error;
+        std::mutex errorMutex;
+    };
+
+    // Preconditions: job is alive.
+    // Postconditions: Claim and run tasks of job until none are left. Return whether this call finished the job.
+    bool work(Job& job);
+
+    void workerLoop();
+
+    std::vector<std::thread> workers;
+    std::deque<std::shared_ptr<Job>> pendingJobs;
+    std::mutex queueMutex;
+    std::condition_variable jobAvailable;
+    std::condition_variable jobFinished;
+    bool stopping;
+};
+
+#endif //PROJ1_THREADPOOL_H
@@ -0,0 +1,40 @@
+// Name : Long Duong
+// Date: 10/17/2026
+// Description: Little-endian fixed width read and write helpers for the binary summary formats.
+
+#ifndef PROJ1_BINARYIO_H
+#define PROJ1_BINARYIO_H
+
+#include <bit>
+#include <istream>
+#include <ostream>
+#include <type_traits>
+#include "../ui/UIExcept.h"
+
+using namespace std;
+
+// Values are written in the host representation, which is little-endian on every supported target.
+static_assert(endian::native == endian::little, "binary summaries are stored little-endian");
+
+// Preconditions: T is trivially copyable.
+// Postconditions: value is appended to out.
+template <typename T>
+void writeBinary(ostream& out, const T& value)
+{
+    static_assert(is_trivially_copyable_v<T>);
+    out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+// Preconditions: T is trivially copyable.
+// Postconditions: Return the next value of in or throw exception if in ends early.
+template <typename T>
+T readBinary(istream& in)
+{
+    static_assert(is_trivially_copyable_v<T>);
+    T value;
+    if (!in.read(reinterpret_cast<char*>(&value), sizeof(T)))
+        throw UIExcept("Truncated binary summary");
+    return value;
+}
+
+#endif //PROJ1_BINARYIO_H
@@ -0,0 +1,153 @@
+// Name : Long Duong
+// Date: 10/17/2026
+// Description: Locale-free number tokenizer built on from_chars that mirrors the behaviour of istream >> T.
+
+#ifndef PROJ1_NUMBERPARSING_H
+#define PROJ1_NUMBERPARSING_H
+
+#include <charconv>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+#include <algorithm>
+#include <istream>
+#include <cstring>
+
+using namespace std;
+
+// Preconditions: None
+// Postconditions: Return whether c is a separator in the classic "C" locale, the same set istream skips.
+inline bool isNumberSeparator(char c)
+{
+    return c == ' ' || c == '\n' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+// Preconditions: [first, last) is a readable character range.
+// Postconditions: Parse one value at first into value. Return the pointer past the value, or nullptr if
+//                 istream >> T would have failed on this token.
+template <typename T>
+const char* parseNumber(const char* first, const char* last, T& value)
+{
+    const char* begin = first;
+    // from_chars rejects the leading '+' that istream accepts.
+    if (begin != last && *begin == '+')
+    {
+        begin++;
+        if (begin == last || *begin == '-' || *begin == '+')
+            return nullptr;
+    }
+    if constexpr (is_floating_point_v<T>)
+    {
+        // from_chars also accepts "inf" and "nan" which istream does not.
+        const char* digits = (begin != last && *begin == '-') ? begin + 1 : begin;
+        if (digits == last || !(('0' <= *digits && *digits <= '9') || *digits == '.'))
+            return nullptr;
+    }
+    auto [ptr, errorCode] = from_chars(begin, last, value);
+    if (errorCode != errc())
+        return nullptr;
+    if constexpr (is_floating_point_v<T>)
+    {
+        // istream consumes a dangling exponent such as "1.5e" and fails, from_chars stops before it.
+        if (ptr != last && (*ptr == 'e' || *ptr == 'E'))
+            return nullptr;
+    }
+    return ptr;
+}
+
+// Preconditions: [first, last) is a readable character range.
+// Postconditions: Every whitespace separated value is appended to out until the range ends or a token fails to
+//                 parse, exactly like a `while (stream >> value)` loop. Return where parsing stopped and set
+//                 stoppedEarly if it stopped on a bad token rather than at last.
+template <typename T>
+const char* parseNumbers(const char* first, const char* last, vector<T>& out, bool& stoppedEarly)
+{
+    stoppedEarly = false;
+    const char* it = first;
+    while (true)
+    {
+        while (it != last && isNumberSeparator(*it))
+            it++;
+        if (it == last)
+            return it;
+
+        T value;
+        const char* next = parseNumber(it, last, value);
+        if (next == nullptr)
+        {
+            stoppedEarly = true;
+            return it;
+        }
+        out.push_back(value);
+        it = next;
+    }
+}
+
+// Preconditions: [first, last) is a readable character range.
+// Postconditions: Return an upper-leaning estimate of how many values the range holds, sampled from its head.
+inline size_t estimateNumberCount(const char* first, const char* last)
+{
+    const size_t sampleBytes = 1 << 16;
+    size_t totalBytes = static_cast<size_t>(last - first);
+    const char* sampleEnd = first + min(totalBytes, sampleBytes);
+
+    size_t tokens = 0;
+    bool inToken = false;
+    for (const char* it = first; it != sampleEnd; it++)
+    {
+        bool separator = isNumberSeparator(*it);
+        if (!separator && !inToken)
+            tokens++;
+        inToken = !separator;
+    }
+    if (tokens == 0)
+        return 0;
+    double bytesPerToken = static_cast<double>(sampleEnd - first) / tokens;
+    return static_cast<size_t>(totalBytes / bytesPerToken * 1.05) + 16;
+}
+
+// Preconditions: in is open on a text file, consume is callable with (const vector<T>& values).
+// Postconditions: The file is read in fixed size chunks so it is never held in memory and the values of each chunk
+//                 are handed to consume in order. Stops at the first bad token like istream >> T. Return the number
+//                 of bytes read.
+template <typename T, typename Consume>
+size_t parseStreamInChunks(istream& in, Consume&& consume)
+{
+    vector<char> buffer(1 << 20);
+    vector<T> values;
+    size_t carried = 0, bytesRead = 0;
+    while (true)
+    {
+        in.read(buffer.data() + carried, buffer.size() - carried);
+        size_t received = static_cast<size_t>(in.gcount());
+        bytesRead += received;
+        bool atEnd = !in;
+        const char* first = buffer.data();
+        const char* filled = first + carried + received;
+
+        // A token cut by the end of the chunk is carried over to the next read.
+        const char* last = filled;
+        if (!atEnd)
+        {
+            while (last != first && !isNumberSeparator(last[-1]))
+                last--;
+            if (last == first)
+            {
+                carried = buffer.size();
+                buffer.resize(buffer.size() * 2);
+                continue;
+            }
+        }
+
+        bool stoppedEarly;
+        values.clear();
+        parseNumbers(first, last, values, stoppedEarly);
+        consume(static_cast<const vector<T>&>(values));
+        if (stoppedEarly || atEnd)
+            return bytesRead;
+        carried = static_cast<size_t>(filled - last);
+        memmove(buffer.data(), last, carried);
+    }
+}
+
+#endif //PROJ1_NUMBERPARSING_H
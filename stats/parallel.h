@@ -0,0 +1,73 @@
+// Name : Long Duong
+// Date: 10/17/2026
+// Description: Small helpers that fan work out over the worker threads configured in config.
+
+#ifndef PROJ1_PARALLEL_H
+#define PROJ1_PARALLEL_H
+
+#include <thread>
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include "ThreadPool.h"
+#include "../ui/configuration.h"
+
+using namespace std;
+
+// Preconditions: None
+// Postconditions: Return the number of worker threads to use, as configured by config::WORKER_THREAD_COUNT.
+inline size_t workerThreadCount()
+{
+    if (config::WORKER_THREAD_COUNT > 0)
+        return static_cast<size_t>(config::WORKER_THREAD_COUNT);
+    return max<size_t>(1, thread::hardware_concurrency());
+}
+
+// Preconditions: None
+// Postconditions: Return the process wide pool, started on first use with workerThreadCount() threads.
+inline ThreadPool& sharedThreadPool()
+{
+    static ThreadPool pool(workerThreadCount());
+    return pool;
+}
+
+// Preconditions: task is callable with a task index in [0, taskCount).
+// Postconditions: Every task ran to completion on the shared pool. The first exception thrown is rethrown.
+template <typename Task>
+void parallelFor(size_t taskCount, Task&& task)
+{
+    if (taskCount == 1)
+    {
+        task(size_t(0));
+        return;
+    }
+    sharedThreadPool().run(taskCount, function<void(size_t)>(ref(task)));
+}
+
+// Preconditions: reduceRange(first, last) returns the partial result of [first, last) and combine merges two
+//                partial results, the left one covering lower indices.
+// Postconditions: Return the reduction of [0, n) starting from identity. With config::DETERMINISTIC_REDUCTIONS the
+//                 range is cut into fixed config::REDUCTION_BLOCK_SIZE blocks combined left to right, so the result
+//                 is bit-identical whatever the thread count; otherwise it is cut into one slice per worker.
+template <typename Result, typename ReduceRange, typename Combine>
+Result parallelReduce(size_t n, Result identity, ReduceRange&& reduceRange, Combine&& combine)
+{
+    size_t blockSize = config::DETERMINISTIC_REDUCTIONS
+        ? static_cast<size_t>(config::REDUCTION_BLOCK_SIZE)
+        : max<size_t>(static_cast<size_t>(config::REDUCTION_BLOCK_SIZE), (n + workerThreadCount() - 1) / workerThreadCount());
+    size_t blockCount = (n + blockSize - 1) / blockSize;
+    if (blockCount <= 1)
+        return n == 0 ? identity : combine(identity, reduceRange(size_t(0), n));
+
+    vector<Result> partials(blockCount, identity);
+    parallelFor(blockCount, [&](size_t block)
+    {
+        partials[block] = reduceRange(block * blockSize, min(n, (block + 1) * blockSize));
+    });
+    Result total = identity;
+    for (const auto& partial : partials)
+        total = combine(total, partial);
+    return total;
+}
+
+#endif //PROJ1_PARALLEL_H
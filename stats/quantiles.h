@@ -0,0 +1,95 @@
+// Name : Long Duong
+// Date: 10/17/2026
+// Description: The nine sample quantile definitions of Hyndman and Fan (R's quantile types 1 to 9) and the
+//              median-of-halves rule shared by the statistics classes that answer ranks without a sorted array.
+
+#ifndef PROJ1_QUANTILES_H
+#define PROJ1_QUANTILES_H
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <cstdint>
+#include <optional>
+
+using namespace std;
+
+// Type1 to Type3 are discontinuous (inverse empirical CDF, its average at jumps, nearest even order statistic);
+// Type4 to Type9 interpolate linearly between order statistics. Type7 is the default of R and numpy.
+enum class QuantileMethod { Type1 = 1, Type2, Type3, Type4, Type5, Type6, Type7, Type8, Type9 };
+
+// Preconditions: n > 0, valueAtRank(r) returns the value at index r of the sorted data for every r < n and
+//                0 <= p <= 1.
+// Postconditions: Return the sample quantile of probability p under the given definition, computed like R's
+//                 quantile() including its tolerance for p * n landing just off an integer.
+template <typename ValueAtRank>
+double rankQuantile(size_t n, double p, QuantileMethod method, ValueAtRank&& valueAtRank)
+{
+    const double fuzz = 4 * numeric_limits<double>::epsilon();
+    double count = static_cast<double>(n);
+    double position, gamma;
+    long long j;
+    if (method <= QuantileMethod::Type3)
+    {
+        position = count * p + (method == QuantileMethod::Type3 ? -0.5 : 0.0);
+        j = static_cast<long long>(floor(position + fuzz));
+        bool onOrderStatistic = position <= j + fuzz;
+        if (method == QuantileMethod::Type1)
+            gamma = onOrderStatistic ? 0.0 : 1.0;
+        else if (method == QuantileMethod::Type2)
+            gamma = onOrderStatistic ? 0.5 : 1.0;
+        else
+            gamma = onOrderStatistic && j % 2 == 0 ? 0.0 : 1.0;
+    }
+    else
+    {
+        // (alpha, beta) plotting positions of types 4 to 9.
+        const double alphas[] = {0.0, 0.5, 0.0, 1.0, 1.0 / 3, 3.0 / 8};
+        const double betas[] = {1.0, 0.5, 0.0, 1.0, 1.0 / 3, 3.0 / 8};
+        size_t type = static_cast<size_t>(method) - static_cast<size_t>(QuantileMethod::Type4);
+        position = alphas[type] + p * (count + 1 - alphas[type] - betas[type]);
+        j = static_cast<long long>(floor(position + fuzz));
+        gamma = position - j;
+        if (abs(gamma) < fuzz)
+            gamma = 0.0;
+    }
+
+    // Order statistics are 1-based; positions before the first or past the last clamp to them.
+    auto orderStatistic = [&valueAtRank, n](long long k) -> double
+    {
+        if (k < 1)
+            return static_cast<double>(valueAtRank(0));
+        if (k > static_cast<long long>(n))
+            return static_cast<double>(valueAtRank(n - 1));
+        return static_cast<double>(valueAtRank(static_cast<size_t>(k - 1)));
+    };
+    if (gamma == 0.0)
+        return orderStatistic(j);
+    return (1 - gamma) * orderStatistic(j) + gamma * orderStatistic(j + 1);
+}
+
+// Preconditions: sorted points to n > 0 values in ascending order and 0 <= p <= 1.
+// Postconditions: Return rankQuantile over the array.
+template <typename T>
+double sortedQuantile(const T* sorted, size_t n, double p, QuantileMethod method)
+{
+    return rankQuantile(n, p, method, [sorted](size_t rank) { return sorted[rank]; });
+}
+
+// Preconditions: valueAtRank(r) returns the value at index r of the sorted data for every r in [lowRank, highRank).
+// Postconditions: Return the median of that index range with the definition of Statistics::getMedianInRange:
+//                 nullopt for fewer than 2 values, the middle value for an odd count and the mean of the two middle
+//                 values for an even count.
+template <typename ValueAtRank>
+optional<double> medianOfRankRange(uint64_t lowRank, uint64_t highRank, ValueAtRank&& valueAtRank)
+{
+    if (highRank <= lowRank + 1)
+        return nullopt;
+    uint64_t distance = highRank - lowRank;
+    uint64_t medianIndex = lowRank + distance / 2;
+    if (distance % 2 == 0)
+        return (valueAtRank(medianIndex) + valueAtRank(medianIndex - 1)) / 2.0;
+    return static_cast<double>(valueAtRank(medianIndex));
+}
+
+#endif //PROJ1_QUANTILES_H
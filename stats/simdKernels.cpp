@@ -0,0 +1,553 @@
+// Name : Long Duong
+// Date: 10/17/2026
+// Description: AVX2 and SSE4.1 implementations of the reduction kernels and the runtime dispatch between them.
+
+#include "simdKernels.h"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define PROJ1_SIMD_X86 1
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#else
+#define PROJ1_SIMD_X86 0
+#endif
+
+// MSVC lets any function use any intrinsic, GCC and Clang need the instruction set enabled per function.
+#if defined(_MSC_VER) && !defined(__clang__)
+#define PROJ1_TARGET_AVX2
+#define PROJ1_TARGET_SSE41
+#else
+#define PROJ1_TARGET_AVX2 __attribute__((target("avx2")))
+#define PROJ1_TARGET_SSE41 __attribute__((target("sse4.1")))
+#endif
+
+namespace
+{
+#if PROJ1_SIMD_X86
+
+    SimdLevel detectSimdLevel()
+    {
+#if defined(_MSC_VER) && !defined(__clang__)
+        int registers[4];
+        __cpuid(registers, 0);
+        int highestLeaf = registers[0];
+        if (highestLeaf < 1)
+            return SimdLevel::Scalar;
+        __cpuid(registers, 1);
+        bool sse41 = (registers[2] & (1 << 19)) != 0;
+        bool osSavesYmm = (registers[2] & (1 << 27)) != 0 && (_xgetbv(0) & 0x6) == 0x6;
+        bool avx2 = false;
+        if (highestLeaf >= 7 && osSavesYmm)
+        {
+            __cpuidex(registers, 7, 0);
+            avx2 = (registers[1] & (1 << 5)) != 0;
+        }
+        if (avx2) return SimdLevel::AVX2;
+        if (sse41) return SimdLevel::SSE41;
+        return SimdLevel::Scalar;
+#else
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) return SimdLevel::AVX2;
+        if (__builtin_cpu_supports("sse4.1")) return SimdLevel::SSE41;
+        return SimdLevel::Scalar;
+#endif
+    }
+
+    /// AVX2
+
+    // Load four consecutive values widened to double.
+    template <typename T>
+    PROJ1_TARGET_AVX2 inline __m256d avx2LoadDoubles(const T* p)
+    {
+        if constexpr (is_same_v<T, double>)
+            return _mm256_loadu_pd(p);
+        else if constexpr (is_same_v<T, float>)
+            return _mm256_cvtps_pd(_mm_loadu_ps(p));
+        else if constexpr (sizeof(T) == 4)
+            return _mm256_cvtepi32_pd(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+        else
+            return _mm256_set_pd(static_cast<double>(p[3]), static_cast<double>(p[2]),
+                                 static_cast<double>(p[1]), static_cast<double>(p[0]));
+    }
+
+    PROJ1_TARGET_AVX2 inline double avx2HorizontalSum(__m256d v)
+    {
+        __m128d pairSum = _mm_add_pd(_mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1));
+        return _mm_cvtsd_f64(_mm_add_sd(pairSum, _mm_unpackhi_pd(pairSum, pairSum)));
+    }
+
+    template <typename T>
+    PROJ1_TARGET_AVX2 KernelSumType<T> avx2Sum(const T* p, size_t n)
+    {
+        size_t i = 0;
+        if constexpr (is_floating_point_v<T>)
+        {
+            __m256d acc0 = _mm256_setzero_pd(), acc1 = _mm256_setzero_pd();
+            for (; i + 8 <= n; i += 8)
+            {
+                acc0 = _mm256_add_pd(acc0, avx2LoadDoubles(p + i));
+                acc1 = _mm256_add_pd(acc1, avx2LoadDoubles(p + i + 4));
+            }
+            double total = avx2HorizontalSum(_mm256_add_pd(acc0, acc1));
+            for (; i < n; i++)
+                total += p[i];
+            return total;
+        }
+        else
+        {
+            __m256i acc = _mm256_setzero_si256();
+            for (; i + 4 <= n; i += 4)
+            {
+                __m256i values;
+                if constexpr (sizeof(T) == 4)
+                    values = _mm256_cvtepi32_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i)));
+                else
+                    values = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+                acc = _mm256_add_epi64(acc, values);
+            }
+            alignas(32) long long lanes[4];
+            _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+            long long total = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+            for (; i < n; i++)
+                total += p[i];
+            return total;
+        }
+    }
+
+    // Only logical shifts and masks are needed, which both instruction sets have for 64-bit lanes.
+    template <typename T>
+    PROJ1_TARGET_AVX2 SplitSums avx2SplitSums(const T* p, size_t n)
+    {
+        size_t i = 0;
+        __m256i lowMask = _mm256_set1_epi64x(0xFFFFFFFFll);
+        __m256i high = _mm256_setzero_si256(), low = _mm256_setzero_si256(), negatives = _mm256_setzero_si256();
+        for (; i + 4 <= n; i += 4)
+        {
+            __m256i values = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+            high = _mm256_add_epi64(high, _mm256_srli_epi64(values, 32));
+            low = _mm256_add_epi64(low, _mm256_and_si256(values, lowMask));
+            negatives = _mm256_add_epi64(negatives, _mm256_srli_epi64(values, 63));
+        }
+        alignas(32) unsigned long long lanes[3][4];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes[0]), high);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes[1]), low);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes[2]), negatives);
+        SplitSums sums = scalarSplitSums(p + i, n - i);
+        sums.high += lanes[0][0] + lanes[0][1] + lanes[0][2] + lanes[0][3];
+        sums.low += lanes[1][0] + lanes[1][1] + lanes[1][2] + lanes[1][3];
+        sums.negatives += lanes[2][0] + lanes[2][1] + lanes[2][2] + lanes[2][3];
+        return sums;
+    }
+
+    template <typename T>
+    PROJ1_TARGET_AVX2 double avx2SumOfSquares(const T* p, size_t n)
+    {
+        size_t i = 0;
+        __m256d acc0 = _mm256_setzero_pd(), acc1 = _mm256_setzero_pd();
+        for (; i + 8 <= n; i += 8)
+        {
+            __m256d x0 = avx2LoadDoubles(p + i), x1 = avx2LoadDoubles(p + i + 4);
+            acc0 = _mm256_add_pd(acc0, _mm256_mul_pd(x0, x0));
+            acc1 = _mm256_add_pd(acc1, _mm256_mul_pd(x1, x1));
+        }
+        double total = avx2HorizontalSum(_mm256_add_pd(acc0, acc1));
+        return total + scalarSumOfSquares(p + i, n - i);
+    }
+
+    template <typename T>
+    PROJ1_TARGET_AVX2 CentralSums avx2CentralSums(const T* p, size_t n, double pivot)
+    {
+        size_t i = 0;
+        __m256d center = _mm256_set1_pd(pivot);
+        __m256d acc1 = _mm256_setzero_pd(), acc2 = _mm256_setzero_pd();
+        __m256d acc3 = _mm256_setzero_pd(), acc4 = _mm256_setzero_pd();
+        for (; i + 4 <= n; i += 4)
+        {
+            __m256d d = _mm256_sub_pd(avx2LoadDoubles(p + i), center);
+            __m256d d2 = _mm256_mul_pd(d, d);
+            acc1 = _mm256_add_pd(acc1, d);
+            acc2 = _mm256_add_pd(acc2, d2);
+            acc3 = _mm256_add_pd(acc3, _mm256_mul_pd(d2, d));
+            acc4 = _mm256_add_pd(acc4, _mm256_mul_pd(d2, d2));
+        }
+        CentralSums tail = scalarCentralSums(p + i, n - i, pivot);
+        return CentralSums {
+            avx2HorizontalSum(acc1) + tail.s1,
+            avx2HorizontalSum(acc2) + tail.s2,
+            avx2HorizontalSum(acc3) + tail.s3,
+            avx2HorizontalSum(acc4) + tail.s4
+        };
+    }
+
+    template <typename T>
+    PROJ1_TARGET_AVX2 pair<T, T> avx2MinMax(const T* p, size_t n)
+    {
+        size_t i = 0;
+        pair<T, T> result {p[0], p[0]};
+        if constexpr (is_same_v<T, double>)
+        {
+            if (n >= 4)
+            {
+                __m256d low = _mm256_loadu_pd(p), high = low;
+                for (i = 4; i + 4 <= n; i += 4)
+                {
+                    __m256d x = _mm256_loadu_pd(p + i);
+                    low = _mm256_min_pd(low, x);
+                    high = _mm256_max_pd(high, x);
+                }
+                alignas(32) double lows[4], highs[4];
+                _mm256_store_pd(lows, low);
+                _mm256_store_pd(highs, high);
+                result = {scalarMinMax(lows, 4).first, scalarMinMax(highs, 4).second};
+            }
+        }
+        else if constexpr (is_same_v<T, float>)
+        {
+            if (n >= 8)
+            {
+                __m256 low = _mm256_loadu_ps(p), high = low;
+                for (i = 8; i + 8 <= n; i += 8)
+                {
+                    __m256 x = _mm256_loadu_ps(p + i);
+                    low = _mm256_min_ps(low, x);
+                    high = _mm256_max_ps(high, x);
+                }
+                alignas(32) float lows[8], highs[8];
+                _mm256_store_ps(lows, low);
+                _mm256_store_ps(highs, high);
+                result = {scalarMinMax(lows, 8).first, scalarMinMax(highs, 8).second};
+            }
+        }
+        else if constexpr (sizeof(T) == 4)
+        {
+            if (n >= 8)
+            {
+                __m256i low = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)), high = low;
+                for (i = 8; i + 8 <= n; i += 8)
+                {
+                    __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+                    low = _mm256_min_epi32(low, x);
+                    high = _mm256_max_epi32(high, x);
+                }
+                alignas(32) T lows[8], highs[8];
+                _mm256_store_si256(reinterpret_cast<__m256i*>(lows), low);
+                _mm256_store_si256(reinterpret_cast<__m256i*>(highs), high);
+                result = {scalarMinMax(lows, 8).first, scalarMinMax(highs, 8).second};
+            }
+        }
+        else
+        {
+            if (n >= 4)
+            {
+                __m256i low = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)), high = low;
+                for (i = 4; i + 4 <= n; i += 4)
+                {
+                    __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+                    low = _mm256_blendv_epi8(low, x, _mm256_cmpgt_epi64(low, x));
+                    high = _mm256_blendv_epi8(high, x, _mm256_cmpgt_epi64(x, high));
+                }
+                alignas(32) T lows[4], highs[4];
+                _mm256_store_si256(reinterpret_cast<__m256i*>(lows), low);
+                _mm256_store_si256(reinterpret_cast<__m256i*>(highs), high);
+                result = {scalarMinMax(lows, 4).first, scalarMinMax(highs, 4).second};
+            }
+        }
+        for (; i < n; i++)
+        {
+            if (p[i] < result.first) result.first = p[i];
+            if (result.second < p[i]) result.second = p[i];
+        }
+        return result;
+    }
+
+    /// SSE4.1
+
+    // Load two consecutive values widened to double.
+    template <typename T>
+    PROJ1_TARGET_SSE41 inline __m128d sseLoadDoubles(const T* p)
+    {
+        if constexpr (is_same_v<T, double>)
+            return _mm_loadu_pd(p);
+        else if constexpr (is_same_v<T, float>)
+            return _mm_cvtps_pd(_mm_castsi128_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p))));
+        else if constexpr (sizeof(T) == 4)
+            return _mm_cvtepi32_pd(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p)));
+        else
+            return _mm_set_pd(static_cast<double>(p[1]), static_cast<double>(p[0]));
+    }
+
+    PROJ1_TARGET_SSE41 inline double sseHorizontalSum(__m128d v)
+    {
+        return _mm_cvtsd_f64(_mm_add_sd(v, _mm_unpackhi_pd(v, v)));
+    }
+
+    template <typename T>
+    PROJ1_TARGET_SSE41 KernelSumType<T> sseSum(const T* p, size_t n)
+    {
+        size_t i = 0;
+        if constexpr (is_floating_point_v<T>)
+        {
+            __m128d acc0 = _mm_setzero_pd(), acc1 = _mm_setzero_pd();
+            for (; i + 4 <= n; i += 4)
+            {
+                acc0 = _mm_add_pd(acc0, sseLoadDoubles(p + i));
+                acc1 = _mm_add_pd(acc1, sseLoadDoubles(p + i + 2));
+            }
+            double total = sseHorizontalSum(_mm_add_pd(acc0, acc1));
+            for (; i < n; i++)
+                total += p[i];
+            return total;
+        }
+        else
+        {
+            __m128i acc = _mm_setzero_si128();
+            for (; i + 2 <= n; i += 2)
+            {
+                __m128i values;
+                if constexpr (sizeof(T) == 4)
+                    values = _mm_cvtepi32_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p + i)));
+                else
+                    values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+                acc = _mm_add_epi64(acc, values);
+            }
+            alignas(16) long long lanes[2];
+            _mm_store_si128(reinterpret_cast<__m128i*>(lanes), acc);
+            long long total = lanes[0] + lanes[1];
+            for (; i < n; i++)
+                total += p[i];
+            return total;
+        }
+    }
+
+    template <typename T>
+    PROJ1_TARGET_SSE41 SplitSums sseSplitSums(const T* p, size_t n)
+    {
+        size_t i = 0;
+        __m128i lowMask = _mm_set1_epi64x(0xFFFFFFFFll);
+        __m128i high = _mm_setzero_si128(), low = _mm_setzero_si128(), negatives = _mm_setzero_si128();
+        for (; i + 2 <= n; i += 2)
+        {
+            __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+            high = _mm_add_epi64(high, _mm_srli_epi64(values, 32));
+            low = _mm_add_epi64(low, _mm_and_si128(values, lowMask));
+            negatives = _mm_add_epi64(negatives, _mm_srli_epi64(values, 63));
+        }
+        alignas(16) unsigned long long lanes[3][2];
+        _mm_store_si128(reinterpret_cast<__m128i*>(lanes[0]), high);
+        _mm_store_si128(reinterpret_cast<__m128i*>(lanes[1]), low);
+        _mm_store_si128(reinterpret_cast<__m128i*>(lanes[2]), negatives);
+        SplitSums sums = scalarSplitSums(p + i, n - i);
+        sums.high += lanes[0][0] + lanes[0][1];
+        sums.low += lanes[1][0] + lanes[1][1];
+        sums.negatives += lanes[2][0] + lanes[2][1];
+        return sums;
+    }
+
+    template <typename T>
+    PROJ1_TARGET_SSE41 double sseSumOfSquares(const T* p, size_t n)
+    {
+        size_t i = 0;
+        __m128d acc0 = _mm_setzero_pd(), acc1 = _mm_setzero_pd();
+        for (; i + 4 <= n; i += 4)
+        {
+            __m128d x0 = sseLoadDoubles(p + i), x1 = sseLoadDoubles(p + i + 2);
+            acc0 = _mm_add_pd(acc0, _mm_mul_pd(x0, x0));
+            acc1 = _mm_add_pd(acc1, _mm_mul_pd(x1, x1));
+        }
+        double total = sseHorizontalSum(_mm_add_pd(acc0, acc1));
+        return total + scalarSumOfSquares(p + i, n - i);
+    }
+
+    template <typename T>
+    PROJ1_TARGET_SSE41 CentralSums sseCentralSums(const T* p, size_t n, double pivot)
+    {
+        size_t i = 0;
+        __m128d center = _mm_set1_pd(pivot);
+        __m128d acc1 = _mm_setzero_pd(), acc2 = _mm_setzero_pd();
+        __m128d acc3 = _mm_setzero_pd(), acc4 = _mm_setzero_pd();
+        for (; i + 2 <= n; i += 2)
+        {
+            __m128d d = _mm_sub_pd(sseLoadDoubles(p + i), center);
+            __m128d d2 = _mm_mul_pd(d, d);
+            acc1 = _mm_add_pd(acc1, d);
+            acc2 = _mm_add_pd(acc2, d2);
+            acc3 = _mm_add_pd(acc3, _mm_mul_pd(d2, d));
+            acc4 = _mm_add_pd(acc4, _mm_mul_pd(d2, d2));
+        }
+        CentralSums tail = scalarCentralSums(p + i, n - i, pivot);
+        return CentralSums {
+            sseHorizontalSum(acc1) + tail.s1,
+            sseHorizontalSum(acc2) + tail.s2,
+            sseHorizontalSum(acc3) + tail.s3,
+            sseHorizontalSum(acc4) + tail.s4
+        };
+    }
+
+    template <typename T>
+    PROJ1_TARGET_SSE41 pair<T, T> sseMinMax(const T* p, size_t n)
+    {
+        size_t i = 0;
+        pair<T, T> result {p[0], p[0]};
+        if constexpr (is_same_v<T, double>)
+        {
+            if (n >= 2)
+            {
+                __m128d low = _mm_loadu_pd(p), high = low;
+                for (i = 2; i + 2 <= n; i += 2)
+                {
+                    __m128d x = _mm_loadu_pd(p + i);
+                    low = _mm_min_pd(low, x);
+                    high = _mm_max_pd(high, x);
+                }
+                alignas(16) double lows[2], highs[2];
+                _mm_store_pd(lows, low);
+                _mm_store_pd(highs, high);
+                result = {scalarMinMax(lows, 2).first, scalarMinMax(highs, 2).second};
+            }
+        }
+        else if constexpr (is_same_v<T, float>)
+        {
+            if (n >= 4)
+            {
+                __m128 low = _mm_loadu_ps(p), high = low;
+                for (i = 4; i + 4 <= n; i += 4)
+                {
+                    __m128 x = _mm_loadu_ps(p + i);
+                    low = _mm_min_ps(low, x);
+                    high = _mm_max_ps(high, x);
+                }
+                alignas(16) float lows[4], highs[4];
+                _mm_store_ps(lows, low);
+                _mm_store_ps(highs, high);
+                result = {scalarMinMax(lows, 4).first, scalarMinMax(highs, 4).second};
+            }
+        }
+        else if constexpr (sizeof(T) == 4)
+        {
+            if (n >= 4)
+            {
+                __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)), high = low;
+                for (i = 4; i + 4 <= n; i += 4)
+                {
+                    __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+                    low = _mm_min_epi32(low, x);
+                    high = _mm_max_epi32(high, x);
+                }
+                alignas(16) T lows[4], highs[4];
+                _mm_store_si128(reinterpret_cast<__m128i*>(lows), low);
+                _mm_store_si128(reinterpret_cast<__m128i*>(highs), high);
+                result = {scalarMinMax(lows, 4).first, scalarMinMax(highs, 4).second};
+            }
+        }
+        // 64-bit integer compares need SSE4.2, so those stay on the scalar loop below.
+        for (; i < n; i++)
+        {
+            if (p[i] < result.first) result.first = p[i];
+            if (result.second < p[i]) result.second = p[i];
+        }
+        return result;
+    }
+
+#endif
+}
+
+SimdLevel activeSimdLevel()
+{
+#if PROJ1_SIMD_X86
+    static const SimdLevel level = detectSimdLevel();
+    return level;
+#else
+    return SimdLevel::Scalar;
+#endif
+}
+
+template <typename T>
+KernelSumType<T> simdSum(const T* data, size_t n)
+{
+#if PROJ1_SIMD_X86
+    switch (activeSimdLevel())
+    {
+        case SimdLevel::AVX2: return avx2Sum(data, n);
+        case SimdLevel::SSE41: return sseSum(data, n);
+        default: break;
+    }
+#endif
+    return scalarSum(data, n);
+}
+
+template <typename T>
+double simdSumOfSquares(const T* data, size_t n)
+{
+#if PROJ1_SIMD_X86
+    switch (activeSimdLevel())
+    {
+        case SimdLevel::AVX2: return avx2SumOfSquares(data, n);
+        case SimdLevel::SSE41: return sseSumOfSquares(data, n);
+        default: break;
+    }
+#endif
+    return scalarSumOfSquares(data, n);
+}
+
+template <typename T>
+CentralSums simdCentralSums(const T* data, size_t n, double pivot)
+{
+#if PROJ1_SIMD_X86
+    switch (activeSimdLevel())
+    {
+        case SimdLevel::AVX2: return avx2CentralSums(data, n, pivot);
+        case SimdLevel::SSE41: return sseCentralSums(data, n, pivot);
+        default: break;
+    }
+#endif
+    return scalarCentralSums(data, n, pivot);
+}
+
+template <typename T>
+pair<T, T> simdMinMax(const T* data, size_t n)
+{
+#if PROJ1_SIMD_X86
+    switch (activeSimdLevel())
+    {
+        case SimdLevel::AVX2: return avx2MinMax(data, n);
+        case SimdLevel::SSE41: return sseMinMax(data, n);
+        default: break;
+    }
+#endif
+    return scalarMinMax(data, n);
+}
+
+template <typename T>
+SplitSums simdSplitSums(const T* data, size_t n)
+{
+#if PROJ1_SIMD_X86
+    if constexpr (sizeof(T) == 8)
+    {
+        switch (activeSimdLevel())
+        {
+            case SimdLevel::AVX2: return avx2SplitSums(data, n);
+            case SimdLevel::SSE41: return sseSplitSums(data, n);
+            default: break;
+        }
+    }
+#endif
+    return scalarSplitSums(data, n);
+}
+
+#define PROJ1_INSTANTIATE_KERNELS(T) \
+    template KernelSumType<T> simdSum<T>(const T*, size_t); \
+    template double simdSumOfSquares<T>(const T*, size_t); \
+    template CentralSums simdCentralSums<T>(const T*, size_t, double); \
+    template pair<T, T> simdMinMax<T>(const T*, size_t);
+
+PROJ1_INSTANTIATE_KERNELS(int)
+PROJ1_INSTANTIATE_KERNELS(long)
+PROJ1_INSTANTIATE_KERNELS(long long)
+PROJ1_INSTANTIATE_KERNELS(float)
+PROJ1_INSTANTIATE_KERNELS(double)
+
+// long is 32 bits on Windows; the split kernel is only used for 64-bit integers but instantiating both is harmless.
+template SplitSums simdSplitSums<long>(const long*, size_t);
+template SplitSums simdSplitSums<long long>(const long long*, size_t);
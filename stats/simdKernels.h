@@ -0,0 +1,176 @@
+// Name : Long Duong
+// Date: 10/17/2026
+// Description: Reduction kernels (sum, sum of squares, central moment sums, min/max) with AVX2 / SSE4.1 versions
+//              picked at runtime for int, long, long long, float and double, and a scalar fallback for the rest.
+
+#ifndef PROJ1_SIMDKERNELS_H
+#define PROJ1_SIMDKERNELS_H
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+using namespace std;
+
+enum class SimdLevel { Scalar, SSE41, AVX2 };
+
+// Integers are summed in long long, floating values in double.
+template <typename T>
+using KernelSumType = conditional_t<is_integral_v<T>, long long, double>;
+
+// A sum of integers read as unsigned 64-bit words, kept in three parts that cannot overflow for up to 2^31 values:
+// the sums of the high and of the low 32-bit halves, and the number of negative values. The exact sum is
+// high * 2^32 + low - negatives * 2^64.
+struct SplitSums
+{
+    unsigned long long high, low, negatives;
+};
+
+// Sums of the first to fourth powers of (x - pivot).
+struct CentralSums
+{
+    double s1, s2, s3, s4;
+};
+
+template <typename T>
+constexpr bool isSimdKernelType =
+    is_same_v<T, int> || is_same_v<T, long> || is_same_v<T, long long> || is_same_v<T, float> || is_same_v<T, double>;
+
+// Preconditions: None
+// Postconditions: Return the widest instruction set supported by both the build and the running CPU.
+SimdLevel activeSimdLevel();
+
+// Preconditions: T is one of the isSimdKernelType types and data points to n values.
+// Postconditions: Return the result of the matching kernel using the active instruction set.
+template <typename T> KernelSumType<T> simdSum(const T* data, size_t n);
+template <typename T> double simdSumOfSquares(const T* data, size_t n);
+template <typename T> CentralSums simdCentralSums(const T* data, size_t n, double pivot);
+template <typename T> pair<T, T> simdMinMax(const T* data, size_t n);
+template <typename T> SplitSums simdSplitSums(const T* data, size_t n);
+
+// Preconditions: data points to n values.
+// Postconditions: Return the sum of the values.
+template <typename T>
+KernelSumType<T> scalarSum(const T* data, size_t n)
+{
+    KernelSumType<T> total = 0;
+    for (size_t i = 0; i < n; i++)
+        total += data[i];
+    return total;
+}
+
+// Preconditions: data points to n values.
+// Postconditions: Return the sum of the squared values.
+template <typename T>
+double scalarSumOfSquares(const T* data, size_t n)
+{
+    double total = 0;
+    for (size_t i = 0; i < n; i++)
+        total += static_cast<double>(data[i]) * static_cast<double>(data[i]);
+    return total;
+}
+
+// Preconditions: data points to n values.
+// Postconditions: Return the sums of the first four powers of the deviations from pivot.
+template <typename T>
+CentralSums scalarCentralSums(const T* data, size_t n, double pivot)
+{
+    CentralSums sums {0, 0, 0, 0};
+    for (size_t i = 0; i < n; i++)
+    {
+        double d = static_cast<double>(data[i]) - pivot;
+        double d2 = d * d;
+        sums.s1 += d;
+        sums.s2 += d2;
+        sums.s3 += d2 * d;
+        sums.s4 += d2 * d2;
+    }
+    return sums;
+}
+
+// Preconditions: T is an integer type and data points to at most 2^31 values.
+// Postconditions: Return the split sums of the values.
+template <typename T>
+SplitSums scalarSplitSums(const T* data, size_t n)
+{
+    SplitSums sums {0, 0, 0};
+    for (size_t i = 0; i < n; i++)
+    {
+        auto bits = static_cast<unsigned long long>(data[i]);
+        sums.high += bits >> 32;
+        sums.low += bits & 0xFFFFFFFFull;
+        sums.negatives += bits >> 63;
+    }
+    return sums;
+}
+
+// Preconditions: data points to n > 0 values.
+// Postconditions: Return the smallest and largest value.
+template <typename T>
+pair<T, T> scalarMinMax(const T* data, size_t n)
+{
+    pair<T, T> result {data[0], data[0]};
+    for (size_t i = 1; i < n; i++)
+    {
+        if (data[i] < result.first) result.first = data[i];
+        if (result.second < data[i]) result.second = data[i];
+    }
+    return result;
+}
+
+// Preconditions: data points to n values.
+// Postconditions: Return the sum of the values.
+template <typename T>
+KernelSumType<T> kernelSum(const T* data, size_t n)
+{
+    if constexpr (isSimdKernelType<T>)
+        return simdSum(data, n);
+    else
+        return scalarSum(data, n);
+}
+
+// Preconditions: data points to n values.
+// Postconditions: Return the sum of the squared values.
+template <typename T>
+double kernelSumOfSquares(const T* data, size_t n)
+{
+    if constexpr (isSimdKernelType<T>)
+        return simdSumOfSquares(data, n);
+    else
+        return scalarSumOfSquares(data, n);
+}
+
+// Preconditions: data points to n values.
+// Postconditions: Return the sums of the first four powers of the deviations from pivot.
+template <typename T>
+CentralSums kernelCentralSums(const T* data, size_t n, double pivot)
+{
+    if constexpr (isSimdKernelType<T>)
+        return simdCentralSums(data, n, pivot);
+    else
+        return scalarCentralSums(data, n, pivot);
+}
+
+// Preconditions: T is an integer type and data points to at most 2^31 values.
+// Postconditions: Return the split sums of the values.
+template <typename T>
+SplitSums kernelSplitSums(const T* data, size_t n)
+{
+    if constexpr (isSimdKernelType<T> && is_integral_v<T> && sizeof(T) == 8)
+        return simdSplitSums(data, n);
+    else
+        return scalarSplitSums(data, n);
+}
+
+// Preconditions: data points to n > 0 values.
+// Postconditions: Return the smallest and largest value.
+template <typename T>
+pair<T, T> kernelMinMax(const T* data, size_t n)
+{
+    if constexpr (isSimdKernelType<T>)
+        return simdMinMax(data, n);
+    else
+        return scalarMinMax(data, n);
+}
+
+#endif //PROJ1_SIMDKERNELS_H
@@ -0,0 +1,223 @@
+// Name : Long Duong
+// Date: 10/17/2026
+// Description: The sort stage run after loading: std::sort, a parallel merge sort and an LSD radix sort for integers.
+
+#ifndef PROJ1_SORTING_H
+#define PROJ1_SORTING_H
+
+#include <vector>
+#include <algorithm>
+#include <array>
+#include <type_traits>
+#include <cstdint>
+#include "parallel.h"
+
+using namespace std;
+
+// Standard is a serial std::sort, ParallelMerge sorts one chunk per worker then merges the runs pairwise with
+// every worker helping on each merge, and Radix is an 8-bit LSD radix sort (integral types only, other types
+// fall back to ParallelMerge).
+enum class SortAlgorithm { Standard, ParallelMerge, Radix };
+
+// Preconditions: Two sorted ranges and an output range large enough for both.
+// Postconditions: Both ranges are merged into out, split into threadCount independent pieces merged concurrently.
+template <typename T>
+void parallelMerge(const T* aFirst, const T* aLast, const T* bFirst, const T* bLast, T* out, size_t threadCount)
+{
+    size_t aSize = aLast - aFirst, bSize = bLast - bFirst;
+    if (aSize < bSize)
+    {
+        swap(aFirst, bFirst);
+        swap(aLast, bLast);
+        swap(aSize, bSize);
+    }
+    const size_t minimumPieceSize = 1 << 16;
+    size_t pieceCount = min(threadCount, max<size_t>(1, (aSize + bSize) / minimumPieceSize));
+
+    // Piece i takes a[aCuts[i], aCuts[i+1]) and the part of b below a[aCuts[i+1]].
+    vector<size_t> aCuts(pieceCount + 1), bCuts(pieceCount + 1);
+    aCuts[pieceCount] = aSize;
+    bCuts[pieceCount] = bSize;
+    for (size_t i = 1; i < pieceCount; i++)
+    {
+        aCuts[i] = aSize / pieceCount * i;
+        bCuts[i] = lower_bound(bFirst, bLast, aFirst[aCuts[i]]) - bFirst;
+    }
+    parallelFor(pieceCount, [&](size_t piece)
+    {
+        merge(aFirst + aCuts[piece], aFirst + aCuts[piece + 1],
+              bFirst + bCuts[piece], bFirst + bCuts[piece + 1],
+              out + aCuts[piece] + bCuts[piece]);
+    });
+}
+
+// Preconditions: None
+// Postconditions: values is sorted ascending, using one sorted run per worker merged pairwise in parallel.
+template <typename T>
+void parallelMergeSort(vector<T>& values)
+{
+    const size_t minimumRunSize = 1 << 16;
+    size_t runCount = min(workerThreadCount(), max<size_t>(1, values.size() / minimumRunSize));
+    if (runCount <= 1)
+    {
+        sort(values.begin(), values.end());
+        return;
+    }
+
+    vector<size_t> runBounds(runCount + 1);
+    for (size_t i = 0; i <= runCount; i++)
+        runBounds[i] = values.size() / runCount * i;
+    runBounds[runCount] = values.size();
+    parallelFor(runCount, [&](size_t run)
+    {
+        sort(values.begin() + runBounds[run], values.begin() + runBounds[run + 1]);
+    });
+
+    // Ping-pong between values and buffer, halving the number of runs on every round.
+    vector<T> buffer(values.size());
+    T* source = values.data();
+    T* destination = buffer.data();
+    while (runBounds.size() > 2)
+    {
+        vector<size_t> mergedBounds {0};
+        for (size_t i = 0; i + 1 < runBounds.size(); i += 2)
+        {
+            if (i + 2 < runBounds.size())
+            {
+                parallelMerge(source + runBounds[i], source + runBounds[i + 1],
+                              source + runBounds[i + 1], source + runBounds[i + 2],
+                              destination + runBounds[i], workerThreadCount());
+                mergedBounds.push_back(runBounds[i + 2]);
+            }
+            else
+            {
+                copy(source + runBounds[i], source + runBounds[i + 1], destination + runBounds[i]);
+                mergedBounds.push_back(runBounds[i + 1]);
+            }
+        }
+        runBounds = move(mergedBounds);
+        swap(source, destination);
+    }
+    if (source != values.data())
+        values.swap(buffer);
+}
+
+// Preconditions: T is an integral type.
+// Postconditions: Return the key of value as an unsigned integer that orders the same way as value.
+template <typename T>
+make_unsigned_t<T> radixKey(T value)
+{
+    using Key = make_unsigned_t<T>;
+    Key key = static_cast<Key>(value);
+    if constexpr (is_signed_v<T>)
+        key ^= Key(1) << (sizeof(T) * 8 - 1);
+    return key;
+}
+
+// Preconditions: T is an integral type.
+// Postconditions: values is sorted ascending by a stable LSD radix sort over 8-bit digits. Each worker counts and
+//                 scatters its own slice; digits on which every key agrees are skipped.
+template <typename T>
+void radixSort(vector<T>& values)
+{
+    static_assert(is_integral_v<T>, "radixSort requires an integral type");
+    constexpr size_t digitCount = sizeof(T);
+    const size_t minimumSliceSize = 1 << 16;
+    size_t sliceCount = min(workerThreadCount(), max<size_t>(1, values.size() / minimumSliceSize));
+    size_t n = values.size();
+    auto sliceBegin = [n, sliceCount](size_t slice) { return n / sliceCount * slice; };
+    auto sliceEnd = [n, sliceCount, &sliceBegin](size_t slice) { return slice + 1 == sliceCount ? n : sliceBegin(slice + 1); };
+
+    // histograms[slice][digit][bucket], all digits are counted in a single pass. Summed over slices they tell
+    // which digits are trivial; the per slice counts are only valid for the first scatter since later passes
+    // move values between slices.
+    vector<array<array<size_t, 256>, digitCount>> histograms(sliceCount);
+    parallelFor(sliceCount, [&](size_t slice)
+    {
+        auto& histogram = histograms[slice];
+        for (auto& digit : histogram)
+            digit.fill(0);
+        for (size_t i = sliceBegin(slice); i < sliceEnd(slice); i++)
+        {
+            auto key = radixKey(values[i]);
+            for (size_t digit = 0; digit < digitCount; digit++)
+                histogram[digit][(key >> (digit * 8)) & 0xFF]++;
+        }
+    });
+
+    vector<T> buffer(n);
+    T* source = values.data();
+    T* destination = buffer.data();
+    bool firstScatter = true;
+    for (size_t digit = 0; digit < digitCount; digit++)
+    {
+        bool trivialDigit = false;
+        for (size_t bucket = 0; bucket < 256 && !trivialDigit; bucket++)
+        {
+            size_t bucketTotal = 0;
+            for (size_t slice = 0; slice < sliceCount; slice++)
+                bucketTotal += histograms[slice][digit][bucket];
+            trivialDigit = bucketTotal == n;
+        }
+        if (trivialDigit)
+            continue;
+
+        vector<array<size_t, 256>> counts(sliceCount);
+        parallelFor(sliceCount, [&](size_t slice)
+        {
+            if (firstScatter || sliceCount == 1)
+            {
+                counts[slice] = histograms[slice][digit];
+                return;
+            }
+            counts[slice].fill(0);
+            for (size_t i = sliceBegin(slice); i < sliceEnd(slice); i++)
+                counts[slice][(radixKey(source[i]) >> (digit * 8)) & 0xFF]++;
+        });
+
+        // Offsets are bucket-major then slice-minor so the scatter stays stable.
+        vector<array<size_t, 256>> offsets(sliceCount);
+        size_t running = 0;
+        for (size_t bucket = 0; bucket < 256; bucket++)
+        {
+            for (size_t slice = 0; slice < sliceCount; slice++)
+            {
+                offsets[slice][bucket] = running;
+                running += counts[slice][bucket];
+            }
+        }
+
+        parallelFor(sliceCount, [&](size_t slice)
+        {
+            auto& offset = offsets[slice];
+            for (size_t i = sliceBegin(slice); i < sliceEnd(slice); i++)
+                destination[offset[(radixKey(source[i]) >> (digit * 8)) & 0xFF]++] = source[i];
+        });
+        swap(source, destination);
+        firstScatter = false;
+    }
+    if (source != values.data())
+        values.swap(buffer);
+}
+
+// Preconditions: None
+// Postconditions: values is sorted ascending with the requested algorithm.
+template <typename T>
+void sortValues(vector<T>& values, SortAlgorithm algorithm)
+{
+    if (algorithm == SortAlgorithm::Radix)
+    {
+        if constexpr (is_integral_v<T>)
+        {
+            radixSort(values);
+            return;
+        }
+        algorithm = SortAlgorithm::ParallelMerge;
+    }
+    if (algorithm == SortAlgorithm::ParallelMerge)
+        parallelMergeSort(values);
+    else
+        sort(values.begin(), values.end());
+}
+
+#endif //PROJ1_SORTING_H
@@ -0,0 +1,212 @@
+// Name : Long Duong
+// Date: 10/17/2026
+// Description: Sums that cannot overflow or drift: 128-bit integer accumulation for integers and Kahan-Neumaier
+//              compensated accumulation for floating values, reduced in parallel.
+
+#ifndef PROJ1_WIDESUM_H
+#define PROJ1_WIDESUM_H
+
+#include <cmath>
+#include <cstdint>
+#include <type_traits>
+#include "Int128.h"
+#include "binaryIO.h"
+#include "simdKernels.h"
+#include "parallel.h"
+
+using namespace std;
+
+template <typename T, bool = is_integral_v<T>>
+class WideAccumulator;
+
+// Integers narrower than 64 bits are summed by the vector kernels in long long, which is exact for every chunk of
+// at most 2^31 values, and each chunk total is widened. 64-bit values go through the split sum kernel, whose parts
+// cannot overflow within a chunk either.
+template <typename T>
+class WideAccumulator<T, true>
+{
+public:
+    // Preconditions: None
+    // Postconditions: value is added.
+    void add(const T& value)
+    {
+        total += Int128(value);
+    }
+
+    // Preconditions: None
+    // Postconditions: value is added count times.
+    void addRepeated(const T& value, uint64_t count)
+    {
+        total += Int128(value) * count;
+    }
+
+    // Preconditions: data points to n values.
+    // Postconditions: The values are added.
+    void addBlock(const T* data, size_t n)
+    {
+        for (size_t first = 0; first < n; first += CHUNK_SIZE)
+        {
+            size_t length = min(CHUNK_SIZE, n - first);
+            if constexpr (sizeof(T) < sizeof(uint64_t))
+                total += Int128(kernelSum(data + first, length));
+            else
+                total += splitSum(data + first, length);
+        }
+    }
+
+    // Preconditions: None
+    // Postconditions: The values added to other are added.
+    void merge(const WideAccumulator& other)
+    {
+        total += other.total;
+    }
+
+    // Preconditions: None
+    // Postconditions: Return the exact sum.
+    Int128 value() const
+    {
+        return total;
+    }
+
+    // Preconditions: None
+    // Postconditions: The 128-bit total is appended to out, high word first.
+    void writeTo(ostream& out) const
+    {
+        writeBinary(out, total);
+    }
+
+    // Preconditions: in is positioned on data written by writeTo.
+    // Postconditions: Return the accumulator read back or throw exception if in ends early.
+    static WideAccumulator readFrom(istream& in)
+    {
+        WideAccumulator accumulator;
+        accumulator.total = readBinary<Int128>(in);
+        return accumulator;
+    }
+
+private:
+    static constexpr size_t CHUNK_SIZE = size_t(1) << 20;
+
+    Int128 total;
+
+    static Int128 splitSum(const T* data, size_t n)
+    {
+        SplitSums sums = kernelSplitSums(data, n);
+        Int128 total = (Int128(sums.high) << 32) + Int128(sums.low);
+        if constexpr (is_signed_v<T>)
+            total = total - ((Int128(sums.negatives) << 32) << 32);
+        return total;
+    }
+};
+
+// Neumaier's variant of Kahan summation: the rounding error of every addition is kept in a separate compensation
+// term, so the result is as accurate as summing in twice the precision, independent of n. Four interleaved lanes
+// hide the latency of the dependent additions.
+template <typename T>
+class WideAccumulator<T, false>
+{
+public:
+    // Preconditions: None
+    // Postconditions: value is added.
+    void add(const T& value)
+    {
+        addTo(sum, compensation, static_cast<double>(value));
+    }
+
+    // Preconditions: None
+    // Postconditions: value is added count times.
+    void addRepeated(const T& value, uint64_t count)
+    {
+        addTo(sum, compensation, static_cast<double>(value) * static_cast<double>(count));
+    }
+
+    // Preconditions: data points to n values.
+    // Postconditions: The values are added.
+    void addBlock(const T* data, size_t n)
+    {
+        const size_t lanes = 4;
+        double laneSums[lanes] = {0, 0, 0, 0}, laneCompensations[lanes] = {0, 0, 0, 0};
+        size_t i = 0;
+        for (; i + lanes <= n; i += lanes)
+            for (size_t lane = 0; lane < lanes; lane++)
+                addTo(laneSums[lane], laneCompensations[lane], static_cast<double>(data[i + lane]));
+        for (; i < n; i++)
+            add(data[i]);
+        for (size_t lane = 0; lane < lanes; lane++)
+        {
+            addTo(sum, compensation, laneSums[lane]);
+            compensation += laneCompensations[lane];
+        }
+    }
+
+    // Preconditions: None
+    // Postconditions: The values added to other are added.
+    void merge(const WideAccumulator& other)
+    {
+        addTo(sum, compensation, other.sum);
+        compensation += other.compensation;
+    }
+
+    // Preconditions: None
+    // Postconditions: Return the compensated sum.
+    double value() const
+    {
+        return sum + compensation;
+    }
+
+    // Preconditions: None
+    // Postconditions: The running sum and its compensation are appended to out.
+    void writeTo(ostream& out) const
+    {
+        writeBinary(out, sum);
+        writeBinary(out, compensation);
+    }
+
+    // Preconditions: in is positioned on data written by writeTo.
+    // Postconditions: Return the accumulator read back or throw exception if in ends early.
+    static WideAccumulator readFrom(istream& in)
+    {
+        WideAccumulator accumulator;
+        accumulator.sum = readBinary<double>(in);
+        accumulator.compensation = readBinary<double>(in);
+        return accumulator;
+    }
+
+private:
+    double sum = 0;
+    double compensation = 0;
+
+    static void addTo(double& runningSum, double& runningCompensation, double value)
+    {
+        // Written with selects instead of a branch so that the lanes stay free of mispredictions.
+        double next = runningSum + value;
+        bool sumIsLarger = fabs(runningSum) >= fabs(value);
+        double larger = sumIsLarger ? runningSum : value;
+        double smaller = sumIsLarger ? value : runningSum;
+        runningCompensation += (larger - next) + smaller;
+        runningSum = next;
+    }
+};
+
+// Int128 for integers, double for floating values.
+template <typename T>
+using WideSumType = decltype(declval<WideAccumulator<T>>().value());
+
+// Preconditions: data points to n values.
+// Postconditions: Return the overflow free, compensated sum of the values, computed in parallel.
+template <typename T>
+WideSumType<T> wideSum(const T* data, size_t n)
+{
+    return parallelReduce(
+        n, WideAccumulator<T>(),
+        [data](size_t first, size_t last)
+        {
+            WideAccumulator<T> partial;
+            partial.addBlock(data + first, last - first);
+            return partial;
+        },
+        [](WideAccumulator<T> left, const WideAccumulator<T>& right) { left.merge(right); return left; }
+    ).value();
+}
+
+#endif //PROJ1_WIDESUM_H
@@ -0,0 +1,371 @@
+// Name : Long Duong
+// Date: 10/17/2026
+// Description: A one pass sibling of Statistics that summarizes a stream of values in bounded memory.
+
+#ifndef PROJ1_STREAMINGSTATISTICS_H
+#define PROJ1_STREAMINGSTATISTICS_H
+
+#include <vector>
+#include <optional>
+#include <algorithm>
+#include <functional>
+#include <cmath>
+#include <fstream>
+#include <chrono>
+#include "statistics.h"
+#include "ui/UIExcept.h"
+#include "stats/numberParsing.h"
+#include "stats/PartialAggregate.h"
+#include "stats/quantiles.h"
+
+using namespace std;
+
+// Count, min, max, sum and moments are exact and updated in O(1) per value. Order based statistics come from a
+// KLL sketch: they are exact while isExact() holds and otherwise every rank used is off by at most
+// getNormalizedRankError() * getSize() with 99% confidence. Mode and frequencies are exact up to
+// config::FREQUENCY_SKETCH_CAPACITY distinct values and heavy hitter lower bounds past it.
+template <typename T>
+class StreamingStatistics
+{
+public:
+    using Quartiles = typename Statistics<T>::Quartiles;
+    using FrequencyEntry = typename Statistics<T>::FrequencyEntry;
+    using LoadReport = typename Statistics<T>::LoadReport;
+
+    StreamingStatistics() = default;
+
+    // Preconditions: An aggregate, e.g. several shard aggregates merged together
+    // Postconditions: Instance finalizes the aggregate into the statistics getters.
+    explicit StreamingStatistics(PartialAggregate<T>&& _aggregate) :
+        aggregate {move(_aggregate)}
+    {}
+
+    // Preconditions: A path to a text file
+    // Postconditions: Every value of the file is pushed, read with parseStreamInChunks so the file is never held in
+    //                 memory. Throw exception if file cannot be opened.
+    void loadDataFromFilePath(string path)
+    {
+        ifstream statsFile(path, ios::in | ios::binary);
+        if (!statsFile.is_open())
+            throw UIExcept("Cannot open file");
+        clear();
+
+        auto parseStart = chrono::steady_clock::now();
+        size_t bytesRead = parseStreamInChunks<T>(statsFile, [this](const vector<T>& values)
+        {
+            for (const auto& value : values)
+                push(value);
+        });
+        chrono::duration<double> parseTime = chrono::steady_clock::now() - parseStart;
+
+        _loadReport.bytesRead = bytesRead;
+        _loadReport.valuesParsed = static_cast<size_t>(getSize());
+        _loadReport.parseSeconds = parseTime.count();
+        _loadReport.valuesPerSecond = parseTime.count() > 0 ? getSize() / parseTime.count() : 0;
+    }
+
+    // Preconditions: None
+    // Postconditions: value is folded into every summary.
+    void push(const T& value)
+    {
+        aggregate.push(value);
+        _quartilesCache.reset();
+    }
+
+    // Preconditions: None
+    // Postconditions: Instance summarizes both streams.
+    void merge(const StreamingStatistics& other)
+    {
+        aggregate.merge(other.aggregate);
+        _quartilesCache.reset();
+    }
+
+    // Preconditions: None
+    // Postconditions: Return the aggregate behind the getters, to be merged or written out.
+    const PartialAggregate<T>& getPartialAggregate() const
+    {
+        return aggregate;
+    }
+
+    // Preconditions: loadDataFromFilePath was called.
+    // Postconditions: Return the size and parse throughput of the last load.
+    const LoadReport& getLoadReport() const
+    {
+        return _loadReport;
+    }
+
+    // Preconditions: None
+    // Postconditions: Internal states are cleared to prepare for new data.
+    void clear()
+    {
+        *this = StreamingStatistics();
+    }
+
+    // Preconditions: None
+    // Postconditions: Return whether median, quartiles, outliers and mean absolute deviation are exact.
+    bool isExact() const
+    {
+        return aggregate.getQuantiles().isExact();
+    }
+
+    // Preconditions: None
+    // Postconditions: Return the bound on the rank error of order statistics as a fraction of getSize().
+    double getNormalizedRankError() const
+    {
+        return aggregate.getQuantiles().getNormalizedRankError();
+    }
+
+    // Preconditions: At least one value was pushed.
+    // Postconditions: Return the minimum
+    const T& getMin() const
+    {
+        return aggregate.getMin();
+    }
+
+    // Preconditions: At least one value was pushed.
+    // Postconditions: Return maximum
+    const T& getMax() const
+    {
+        return aggregate.getMax();
+    }
+
+    // Preconditions: At least one value was pushed.
+    // Postconditions: Return range
+    T getRange() const
+    {
+        return getMax() - getMin();
+    }
+
+    // Preconditions: At least one value was pushed.
+    // Postconditions: Return sum of all values.
+    WideSumType<T> getSum() const
+    {
+        return aggregate.getSum();
+    }
+
+    // Preconditions: None
+    // Postconditions: Return number of values pushed.
+    uint64_t getSize() const
+    {
+        return aggregate.getCount();
+    }
+
+    // Preconditions: At least one value was pushed.
+    // Postconditions: Return the mean of all values.
+    double getMean() const
+    {
+        return static_cast<double>(getSum()) / getSize();
+    }
+
+    // Preconditions: At least one value was pushed.
+    // Postconditions: Return an optional that contains the (estimated) median if exist and nullopt otherwise.
+    optional<double> getMedian() const
+    {
+        return getMedianInRange(0, getSize());
+    }
+
+    // Preconditions: At least one value was pushed.
+    // Postconditions: Return the mode, or the most frequent value seen once the frequency sketch overflowed.
+    vector<T> getMode() const
+    {
+        auto counters = aggregate.getFrequencies().getCounters();
+        uint64_t maxFrequency = 0;
+        for (const auto& counter : counters)
+            maxFrequency = max(maxFrequency, counter.second);
+        auto modeElements = vector<T>();
+        for (const auto& counter : counters)
+        {
+            if (counter.second >= maxFrequency)
+                modeElements.push_back(counter.first);
+        }
+        return modeElements;
+    }
+
+    // Preconditions: At least one value was pushed.
+    // Postconditions: Return the variance
+    double getVariance() const
+    {
+        return aggregate.getMoments().getM2() / (getSize() - 1);
+    }
+
+    // Preconditions: At least one value was pushed.
+    // Postconditions: Return the standard deviation
+    double getStandardDeviation() const
+    {
+        return sqrt(getVariance());
+    }
+
+    // Preconditions: At least one value was pushed.
+    // Postconditions: Return the midRange
+    double getMidRange() const
+    {
+        return (getMax() + getMin()) / 2.0;
+    }
+
+    // Preconditions: At least one value was pushed.
+    // Postconditions: Return the quartiles with the same median-of-halves definition as Statistics, each index
+    //                 into the sorted data answered by the sketch.
+    const Quartiles& getQuartiles() const
+    {
+        if (!_quartilesCache.has_value())
+        {
+            uint64_t count = getSize();
+            uint64_t half = count / 2;
+            _quartilesCache.emplace(Quartiles {
+                .Q1 = getMedianInRange(0, half),
+                .Q2 = getMedianInRange(0, count),
+                .Q3 = getMedianInRange(count % 2 == 0 ? half : half + 1, count)
+            });
+        }
+        return _quartilesCache.value();
+    }
+
+    // Preconditions: At least one value was pushed.
+    // Postconditions: Return the IQR if it exists, otherwise nullopt
+    optional<double> getIQR() const
+    {
+        auto& quartiles = getQuartiles();
+        if (!quartiles.Q3.has_value() || !quartiles.Q1.has_value())
+            return nullopt;
+        return quartiles.Q3.value() - quartiles.Q1.value();
+    }
+
+    // Preconditions: At least one value was pushed.
+    // Postconditions: Return outlierFence if IQR exists, nullopt otherwise.
+    optional<pair<double, double>> getOutlierFence() const
+    {
+        if (!getIQR().has_value()) return nullopt;
+        const auto& q = getQuartiles();
+        return make_pair(q.Q1.value() - 1.5 * getIQR().value(), q.Q3.value() + 1.5 * getIQR().value());
+    }
+
+    // Preconditions: At least one value was pushed.
+    // Postconditions: Return the outliers in ascending order. Only the config::STREAMING_EXTREME_CAPACITY smallest
+    //                 and largest values are kept, so at most that many outliers are listed on each side.
+    vector<T> getOutliers() const
+    {
+        auto outliers = vector<T>();
+        if (!getOutlierFence().has_value()) return outliers;
+        auto fence = getOutlierFence().value();
+
+        auto low = aggregate.getSmallestValues();
+        auto high = aggregate.getLargestValues();
+        copy_if(low.cbegin(), low.cend(), back_inserter(outliers), [&fence](const T& e) { return e < fence.first; });
+        copy_if(high.cbegin(), high.cend(), back_inserter(outliers), [&fence](const T& e) { return e > fence.second; });
+        return outliers;
+    }
+
+    // Preconditions: At least one value was pushed.
+    // Postconditions: Return sumOfSquares.
+    double getSumOfSquares() const
+    {
+        return aggregate.getMoments().getM2();
+    }
+
+    // Preconditions: At least one value was pushed.
+    // Postconditions: Return mean absolute deviation, computed over the sketch so exact only while isExact().
+    double getMeanAbsoluteDeviation() const
+    {
+        double mean = aggregate.getMoments().getMean();
+        double deviationSum = 0.0;
+        for (const auto& item : aggregate.getQuantiles().sortedItems())
+            deviationSum += abs(item.first - mean) * item.second;
+        return deviationSum / getSize();
+    }
+
+    // Preconditions: At least one value was pushed.
+    // Postconditions: Return the root mean square
+    double getRootMeanSquare() const
+    {
+        const auto& moments = aggregate.getMoments();
+        return sqrt(moments.getMean() * moments.getMean() + moments.getM2() / getSize());
+    }
+
+    // Preconditions: At least one value was pushed.
+    // Postconditions: Return standard error of the mean
+    double getStdErrorOfMean() const
+    {
+        return getStandardDeviation() / sqrt(getSize());
+    }
+
+    // Preconditions: At least one value was pushed.
+    // Postconditions: Return coefficient of variantion
+    double getCoefficientOfVariation() const
+    {
+        return getStandardDeviation() / getMean();
+    }
+
+    // Preconditions: At least one value was pushed.
+    // Postconditions: Return relative standard deviation.
+    double getRelativeStd() const
+    {
+        return (100.0 * getStandardDeviation()) / getMean();
+    }
+
+    // Preconditions: At least one value was pushed.
+    // Postconditions: Return skewness
+    optional<double> getSkewness() const
+    {
+        double n = static_cast<double>(getSize());
+        if (n * pow(getStandardDeviation(), 3) == 0.0 || (n - 1)*(n - 2) == 0.0)
+            return nullopt;
+        double coefficient = n / ((n - 1) * (n - 2));
+        return coefficient * aggregate.getMoments().getM3() / pow(getStandardDeviation(), 3);
+    }
+
+    // Preconditions: At least one value was pushed.
+    // Postconditions: Return kurtosis.
+    optional<double> getKurtosis() const
+    {
+        double n = static_cast<double>(getSize());
+        if (pow(getStandardDeviation(), 4) == 0.0 || (n - 1)*(n - 2)*(n - 3) == 0.0)
+            return nullopt;
+        double coefficient = n * (n + 1) / ((n - 1) * (n - 2) * (n - 3));
+        return coefficient * aggregate.getMoments().getM4() / pow(getStandardDeviation(), 4);
+    }
+
+    // Preconditions: At least one value was pushed.
+    // Postconditions: Return kurtosis excess
+    optional<double> getKurtosisExcess() const
+    {
+        double n = static_cast<double>(getSize());
+        if (!getKurtosis().has_value() || (n - 2) * (n - 3) == 0)
+            return nullopt;
+        double adjustmentTerm = -3* (n - 1) * (n - 1) / ((n - 2) * (n - 3));
+        return getKurtosis().value() + adjustmentTerm;
+    }
+
+    // Preconditions: At least one value was pushed.
+    // Postconditions: Return the frequency table of the values tracked by the frequency sketch. It is complete
+    //                 and exact while at most config::FREQUENCY_SKETCH_CAPACITY distinct values were seen.
+    vector<FrequencyEntry> getFrequencyTable() const
+    {
+        auto frequencyTable = vector<FrequencyEntry>();
+        double totalFrequency = static_cast<double>(getSize());
+        for (const auto& counter : aggregate.getFrequencies().getCounters())
+        {
+            frequencyTable.push_back(FrequencyEntry{
+                .value = counter.first,
+                .frequency = static_cast<long>(counter.second),
+                .frequencyPercentage = counter.second / totalFrequency
+            });
+        }
+        return frequencyTable;
+    }
+
+protected:
+    PartialAggregate<T> aggregate;
+    LoadReport _loadReport {};
+
+    mutable optional<Quartiles> _quartilesCache;
+
+    /// Helpers
+    // Same definition as Statistics::getMedianInRange over the ranks [lowRank, highRank) of the sorted stream.
+    optional<double> getMedianInRange(uint64_t lowRank, uint64_t highRank) const
+    {
+        const auto& quantiles = aggregate.getQuantiles();
+        return medianOfRankRange(lowRank, highRank, [&quantiles](uint64_t rank) { return quantiles.valueAtRank(rank); });
+    }
+};
+
+#endif //PROJ1_STREAMINGSTATISTICS_H
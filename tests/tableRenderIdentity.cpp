@@ -0,0 +1,147 @@
+// Name : Long Duong
+// Date: 10/17/2026
+// Description: Checks that Table renders byte for byte what the renderer before LineBuffer did: one wstringstream
+//              per cell, copied out one character at a time with the continuation lines indented by the widths of
+//              the columns to their left. Returns 0 when every table matches. Build from the repository root
+//              with the project's compiler, e.g.
+//                  cl /std:c++20 /O2 /EHsc tests\tableRenderIdentity.cpp ui\Table.cpp ui\LineBuffer.cpp
+//                     ui\TextSink.cpp ui\MixedColumn.cpp ui\NumberFormat.cpp
+
+#include <cstdio>
+#include <cstdlib>
+#include <numeric>
+#include <optional>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "../ui/Table.h"
+#include "../ui/MixedColumn.h"
+#include "../ui/SpanColumn.h"
+
+using namespace std;
+
+namespace
+{
+    int failures = 0;
+
+    // The dumpTableTo loop as it was before the line buffer. columns, title and consoleWidth are the ones the
+    // table was built with; a consoleWidth of -1 means the table is not centered.
+    wstring referenceDump(const vector<AbstractColumn*>& columns, const wstring& title, int consoleWidth)
+    {
+        int tableWidth = transform_reduce(columns.cbegin(), columns.cend(), 0, plus<int>(),
+                                          [](const auto& column) { return column->getColumnWidth(); });
+        int leftPadding = consoleWidth < 0 ? 0 : (consoleWidth - tableWidth) / 2;
+        int width = consoleWidth < 0 ? tableWidth : consoleWidth;
+        wostringstream os;
+        if (!title.empty())
+        {
+            os << wstring(leftPadding, L' ') << title << endl;
+            os << wstring(leftPadding, L' ') << wstring(width - 2 * leftPadding, L'=') << endl;
+        }
+        for (size_t i = 0; i <= columns.at(0)->getSize(); i++)
+        {
+            os << wstring(leftPadding, L' ');
+            for (auto columnIt = columns.begin(); columnIt != columns.end(); columnIt++)
+            {
+                wstringstream cell;
+                (*columnIt)->dumpNext(cell);
+                wchar_t c;
+                while (cell.get(c))
+                {
+                    os << c;
+                    if (c == L'\n')
+                    {
+                        int previousColumnsWidth = transform_reduce(
+                            columns.begin(), columnIt, leftPadding, plus<>(),
+                            [](const auto& column) { return column->getColumnWidth(); });
+                        os << wstring(previousColumnsWidth, L' ');
+                    }
+                }
+            }
+            os << endl;
+        }
+        for (auto* column : columns)
+            column->reset();
+        return os.str();
+    }
+
+    // Renders table with Table and with the reference, then frees it.
+    void checkTable(const char* name, const vector<AbstractColumn*>& columns, const wstring& title,
+                    int consoleWidth = config::CONSOLE_WIDTH)
+    {
+        Table* table = consoleWidth < 0 ? new Table(columns, title, -1, false)
+                                        : new Table(columns, title, consoleWidth);
+        wostringstream rendered;
+        table->dumpTableTo(rendered);
+        wstring expected = referenceDump(columns, title, consoleWidth);
+        if (rendered.str() != expected)
+        {
+            failures++;
+            printf("FAILED: %s renders %zu characters, the reference %zu\n", name, rendered.str().size(),
+                   expected.size());
+        }
+        delete table;
+    }
+
+    void checkMenuTable()
+    {
+        auto* keys = new MixedColumn(config::DEFAULT_LEFT_PADDING, config::DEFAULT_RIGHT_PADDING, L"",
+                                     "A", "B", "C", "0");
+        auto* labels = new MixedColumn(config::DEFAULT_LEFT_PADDING, config::DEFAULT_RIGHT_PADDING, L"",
+                                       L"Read data from a file", wstring(L"Echo the data"), "Show statistics",
+                                       L"Exit");
+        checkTable("menu", {keys, labels}, L"3> Descriptive Statistics");
+    }
+
+    void checkEveryCellKind()
+    {
+        auto* names = new MixedColumn(0, 5, L"Kind", "long", "int", "double", "float", "char", "wchar_t",
+                                      "some", "none", "longs", "doubles", "unsigned", "nested");
+        Table* nested = new Table({new MixedColumn(1, 1, L"In", 1, 2, 3), new MixedColumn(1, 1, L"Out", 4.5, -6.25)},
+                                  L"", -1, false);
+        vector<long> longs(300);
+        iota(longs.begin(), longs.end(), -150L);
+        auto* values = new MixedColumn(2, 3, L"Value", -9223372036854775807L, 42, 3.14159265, -0.5f, 'x', L'y',
+                                       optional<double>(1.0 / 3), optional<double>(), longs,
+                                       vector<double> {1.5, -2.25, 1e10}, vector<unsigned> {1, 2, 3}, nested);
+        checkTable("every cell kind", {names, values}, L"Cells");
+    }
+
+    void checkFrequencyTable()
+    {
+        mt19937_64 random(21);
+        auto* valueColumn = new MixedColumn(config::DEFAULT_LEFT_PADDING, config::DEFAULT_RIGHT_PADDING, L"Values");
+        auto* frequencyColumn = new MixedColumn(config::DEFAULT_LEFT_PADDING, config::DEFAULT_RIGHT_PADDING,
+                                                L"Frequency");
+        auto* percentColumn = new MixedColumn(config::DEFAULT_LEFT_PADDING, config::DEFAULT_RIGHT_PADDING,
+                                              L"Percentage");
+        for (int row = 0; row < 10000; row++)
+        {
+            valueColumn->addItems(static_cast<long>(random() % 2000001) - 1000000);
+            frequencyColumn->addItems(static_cast<size_t>(random() % 1000));
+            percentColumn->addItems(static_cast<double>(random() % 100000) / 1000.0);
+        }
+        checkTable("frequency table", {valueColumn, frequencyColumn, percentColumn}, L"", -1);
+    }
+
+    void checkDataSpan()
+    {
+        vector<long> data(100000);
+        mt19937_64 random(22);
+        for (auto& value : data)
+            value = static_cast<long>(random() % 200001) - 100000;
+        checkTable("data span", {new SpanColumn<long>(0, 5, L"", span<const long>(data))}, L"Data");
+        checkTable("truncated data span", {new SpanColumn<long>(0, 5, L"", span<const long>(data), 5, 5)}, L"Data");
+    }
+}
+
+int main()
+{
+    checkMenuTable();
+    checkEveryCellKind();
+    checkFrequencyTable();
+    checkDataSpan();
+    printf(failures == 0 ? "Every table matches the reference renderer.\n" : "%d tables differ.\n", failures);
+    return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
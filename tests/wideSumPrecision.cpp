@@ -0,0 +1,239 @@
+// Name : Long Duong
+// Date: 10/17/2026
+// Description: Precision checks of Int128, of the overflow free and compensated sums, up to 1e9 values, and of
+//              the moments of values near the int64 limits.
+//              Returns 0 when every check passes. Build from the repository root, e.g.
+//                  g++ -std=c++20 -O2 -pthread tests/wideSumPrecision.cpp stats/*.cpp -o wideSumPrecision
+//                  cl /std:c++20 /O2 /EHsc tests\wideSumPrecision.cpp stats\*.cpp
+//              and run with an optional value count, 1000000000 by default.
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+#include "../stats/Int128.h"
+#include "../stats/wideSum.h"
+#include "../statistics.h"
+#include "../streamingStatistics.h"
+#include "../dynamicStatistics.h"
+
+using namespace std;
+
+namespace
+{
+    int failures = 0;
+
+    void check(bool passed, const string& what)
+    {
+        if (!passed)
+        {
+            failures++;
+            printf("FAILED: %s\n", what.c_str());
+        }
+    }
+
+    // The reference for the randomized checks: the compiler's 128-bit integer where there is one. MSVC has none,
+    // so there Int128 is only checked against the known values below and against itself through identities.
+#ifdef __SIZEOF_INT128__
+    using Reference = __int128;
+
+    string referenceText(Reference value)
+    {
+        bool negative = value < 0;
+        unsigned __int128 magnitude = negative ? -static_cast<unsigned __int128>(value) : value;
+        string digits;
+        do
+        {
+            digits.push_back(static_cast<char>('0' + static_cast<int>(magnitude % 10)));
+            magnitude /= 10;
+        } while (magnitude != 0);
+        if (negative)
+            digits.push_back('-');
+        return string(digits.rbegin(), digits.rend());
+    }
+
+    Int128 fromReference(Reference value)
+    {
+        return ((Int128(static_cast<int64_t>(value >> 64)) << 32) << 32) + Int128(static_cast<uint64_t>(value));
+    }
+#else
+    using Reference = Int128;
+
+    string referenceText(const Reference& value)
+    {
+        return value.toString();
+    }
+#endif
+
+    void checkKnownValues()
+    {
+        const int64_t largest = numeric_limits<int64_t>::max();
+        const int64_t lowest = numeric_limits<int64_t>::min();
+        check(Int128(largest).toString() == "9223372036854775807", "int64 max");
+        check(Int128(lowest).toString() == "-9223372036854775808", "int64 min");
+        check(Int128(numeric_limits<uint64_t>::max()).toString() == "18446744073709551615", "uint64 max");
+        check((Int128(largest) + Int128(largest)).toString() == "18446744073709551614", "carry into the high word");
+        check((Int128(lowest) + Int128(lowest)).toString() == "-18446744073709551616", "borrow into the high word");
+        check((Int128(largest) * uint64_t(largest)).toString() == "85070591730234615847396907784232501249",
+              "int64 max squared");
+        check((Int128(lowest) * uint64_t(1000000000)).toString() == "-9223372036854775808000000000",
+              "negative times a count");
+        Int128 lowest128 = (Int128(1) << 63) * (uint64_t(1) << 63) * uint64_t(2);
+        lowest128 = -lowest128;
+        check(lowest128.toString() == "-170141183460469231731687303715884105728", "lowest 128-bit value");
+        check(static_cast<double>(lowest128) == -ldexp(1.0, 127), "lowest 128-bit value as double");
+        check((-Int128(0)).toString() == "0", "negated zero");
+        check(Int128(-1) < Int128(0) && Int128(0) < Int128(numeric_limits<uint64_t>::max()), "ordering");
+        check(to_wstring(Int128(-42)) == L"-42", "to_wstring");
+    }
+
+    void checkRandomOperations(size_t rounds)
+    {
+        mt19937_64 random(3);
+        for (size_t i = 0; i < rounds; i++)
+        {
+            int64_t a = static_cast<int64_t>(random()), b = static_cast<int64_t>(random());
+            int64_t c = static_cast<int64_t>(random());
+            uint64_t count = random() >> (random() % 64);
+            unsigned shift = static_cast<unsigned>(random() % 64);
+            Int128 left = (Int128(a) << shift) + Int128(b);
+            Int128 right = Int128(c);
+            // Identities hold on every compiler.
+            check((left + right) - right == left, "a + b - b");
+            check(-(-left) == left, "double negation");
+            check((left < right) == !(right <= left), "ordering");
+#ifdef __SIZEOF_INT128__
+            Reference x = (static_cast<Reference>(a) << shift) + b;
+            Reference y = c;
+            check(left.toString() == referenceText(x), "shift and add");
+            check((left + right).toString() == referenceText(x + y), "addition");
+            check((left - right).toString() == referenceText(x - y), "subtraction");
+            check((left * count).toString()
+                  == referenceText(static_cast<Reference>(static_cast<unsigned __int128>(x) * count)), "product");
+            check((left < right) == (x < y) && (left == right) == (x == y), "comparison");
+            double expected = static_cast<double>(x);
+            check(fabs(static_cast<double>(left) - expected) <= fabs(expected) * 2.3e-16, "conversion to double");
+            check(fromReference(x) == left, "round trip");
+#endif
+        }
+    }
+
+    // Feeds n values block by block through one buffer that is regenerated for each block, so 1e9 values need
+    // only a few megabytes.
+    void checkLongSums(size_t n)
+    {
+        const size_t blockSize = size_t(1) << 20;
+        mt19937_64 random(5);
+        vector<long long> block(blockSize);
+        WideAccumulator<long long> wide;
+        Reference reference = 0;
+        uint64_t naive = 0;
+        for (size_t done = 0; done < n; done += blockSize)
+        {
+            size_t length = min(blockSize, n - done);
+            for (size_t i = 0; i < length; i++)
+            {
+                block[i] = static_cast<long long>(random());
+                reference += block[i];
+                naive += static_cast<uint64_t>(block[i]);
+            }
+            WideAccumulator<long long> partial;
+            partial.addBlock(block.data(), length);
+            wide.merge(partial);
+        }
+        check(wide.value().toString() == referenceText(reference), "sum of full range int64 values");
+        printf("%zu int64 values: exact %s, wide %s, naive %lld\n", n, referenceText(reference).c_str(),
+               wide.value().toString().c_str(), static_cast<long long>(naive));
+    }
+
+    // Every value is an integer multiple of 2^-20, so the exact sum is known as an integer count of those units.
+    void checkDoubleSums(size_t n)
+    {
+        const size_t blockSize = size_t(1) << 20;
+        mt19937_64 random(7);
+        vector<double> block(blockSize);
+        WideAccumulator<double> compensated;
+        Reference units = 0;
+        double naive = 0.0;
+        for (size_t done = 0; done < n; done += blockSize)
+        {
+            size_t length = min(blockSize, n - done);
+            for (size_t i = 0; i < length; i++)
+            {
+                int64_t unitCount = static_cast<int64_t>(random() >> 11) * (random() & 1 ? 1 : -1);
+                if (random() % 4 == 0)
+                    unitCount >>= 30;
+                block[i] = ldexp(static_cast<double>(unitCount), -20);
+                units += unitCount;
+                naive += block[i];
+            }
+            WideAccumulator<double> partial;
+            partial.addBlock(block.data(), length);
+            compensated.merge(partial);
+        }
+        double exact = ldexp(static_cast<double>(units), -20);
+        double compensatedError = fabs(compensated.value() - exact) / fabs(exact);
+        double naiveError = fabs(naive - exact) / fabs(exact);
+        check(compensatedError <= 4 * numeric_limits<double>::epsilon(), "compensated sum of doubles");
+        printf("%zu doubles: exact %.17g, compensated %.17g (relative error %.3g), naive %.17g (relative error %.3g)\n",
+               n, exact, compensated.value(), compensatedError, naive, naiveError);
+    }
+
+    // 5e18 + 5e18 + 4e18 does not fit in 64 bits; every statistics class must still report it.
+    void checkStatisticsSums()
+    {
+        vector<long long> values {5000000000000000000LL, 5000000000000000000LL, 4000000000000000000LL};
+        const string expected = "14000000000000000000";
+        Statistics<long long> loaded {vector<long long>(values)};
+        StreamingStatistics<long long> streaming;
+        DynamicStatistics<long long> dynamic;
+        for (auto value : values)
+        {
+            streaming.push(value);
+            dynamic.insert(value);
+        }
+        check(loaded.getSum().toString() == expected, "Statistics sum");
+        check(streaming.getSum().toString() == expected, "StreamingStatistics sum");
+        check(dynamic.getSum().toString() == expected, "DynamicStatistics sum");
+        for (double mean : {loaded.getMean(), streaming.getMean(), dynamic.getMean()})
+            check(fabs(mean - 14e18 / 3) <= 1e3, "mean of values past 64 bits");
+        check(fabs(loaded.getSumInRange(0, values[0]) - 14e18) <= 1e4, "Statistics range sum");
+        check(fabs(dynamic.getSumInRange(0, values[0]) - 14e18) <= 1e4, "DynamicStatistics range sum");
+    }
+
+    // 100000 values base + k * 1e6 near +-3e18: any 4096 of them overflow a long long sum, so the moment blocks
+    // must be centred without one. The sample variance is 1e12 * n * (n + 1) / 12 and the distribution is
+    // symmetric and flat.
+    void checkLargeMoments()
+    {
+        const long long count = 100000;
+        const double expectedVariance = 1e12 * count * (count + 1) / 12.0;
+        for (long long base : {3000000000000000000LL, -3000000000000000000LL})
+        {
+            vector<long long> values(count);
+            for (long long k = 0; k < count; k++)
+                values[k] = base + k * 1000000;
+            Statistics<long long> loaded {move(values)};
+            check(fabs(loaded.getVariance() - expectedVariance) <= expectedVariance * 1e-9, "variance near 3e18");
+            check(fabs(loaded.getSkewness().value()) <= 1e-6, "skewness near 3e18");
+            check(fabs(loaded.getKurtosis().value() - 1.8) <= 1e-3, "kurtosis near 3e18");
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    size_t n = argc > 1 ? static_cast<size_t>(strtoull(argv[1], nullptr, 10)) : size_t(1000000000);
+    checkKnownValues();
+    checkRandomOperations(200000);
+    checkStatisticsSums();
+    checkLargeMoments();
+    checkLongSums(n);
+    checkDoubleSums(n);
+    printf(failures == 0 ? "All precision checks passed.\n" : "%d precision checks failed.\n", failures);
+    return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,97 @@
+// Name : Long Duong
+// Date: 10/17/2026
+// Description: Implements the buffered, indenting stream buffer used to render tables.
+
+#include <cwchar>
+#include "LineBuffer.h"
+
+LineBuffer::LineBuffer(TextSink& _target, std::size_t flushThreshold) :
+    target {_target},
+    threshold {flushThreshold},
+    indent {0}
+{
+    pending.reserve(threshold + STAGING_SIZE);
+    // Formatted output is staged in a small put area and only scanned for newlines when it is drained.
+    setp(staging, staging + STAGING_SIZE);
+}
+
+LineBuffer::~LineBuffer()
+{
+    flushToTarget();
+}
+
+void LineBuffer::setIndent(std::size_t width)
+{
+    drainStaging();
+    indent = width;
+}
+
+void LineBuffer::putSpaces(std::size_t count)
+{
+    drainStaging();
+    pending.append(count, L' ');
+}
+
+void LineBuffer::flushToTarget()
+{
+    drainStaging();
+    if (pending.empty())
+        return;
+    target.write(pending.data(), pending.size());
+    pending.clear();
+}
+
+LineBuffer::int_type LineBuffer::overflow(int_type c)
+{
+    drainStaging();
+    if (!traits_type::eq_int_type(c, traits_type::eof()))
+    {
+        wchar_t character = traits_type::to_char_type(c);
+        append(&character, 1);
+    }
+    return traits_type::not_eof(c);
+}
+
+std::streamsize LineBuffer::xsputn(const wchar_t* s, std::streamsize n)
+{
+    drainStaging();
+    append(s, static_cast<std::size_t>(n));
+    return n;
+}
+
+int LineBuffer::sync()
+{
+    drainStaging();
+    return 0;
+}
+
+void LineBuffer::drainStaging()
+{
+    if (pptr() == pbase())
+        return;
+    std::size_t length = static_cast<std::size_t>(pptr() - pbase());
+    setp(staging, staging + STAGING_SIZE);
+    append(staging, length);
+}
+
+void LineBuffer::append(const wchar_t* s, std::size_t n)
+{
+    const wchar_t* end = s + n;
+    while (s != end)
+    {
+        const wchar_t* newline = std::wmemchr(s, L'\n', static_cast<std::size_t>(end - s));
+        if (newline == nullptr)
+        {
+            pending.append(s, end);
+            break;
+        }
+        pending.append(s, newline + 1);
+        pending.append(indent, L' ');
+        s = newline + 1;
+    }
+    if (pending.size() >= threshold)
+    {
+        target.write(pending.data(), pending.size());
+        pending.clear();
+    }
+}
@@ -0,0 +1,58 @@
+// Name : Long Duong
+// Date: 10/17/2026
+// Description: A stream buffer that collects table text in one reusable buffer, indents every continuation line and
+//              hands the text to the output sink in large blocks.
+
+#ifndef PROJ1_LINEBUFFER_H
+#define PROJ1_LINEBUFFER_H
+
+#include <iostream>
+#include <streambuf>
+#include <string>
+#include "TextSink.h"
+
+class LineBuffer : public std::wstreambuf
+{
+public:
+    // Preconditions: target outlives the instance.
+    // Postconditions: Instance collects text for target and writes it once flushThreshold characters are pending.
+    explicit LineBuffer(TextSink& target, std::size_t flushThreshold = 1 << 16);
+
+    // Preconditions: None
+    // Postconditions: Pending text is written to the target.
+    ~LineBuffer() override;
+
+    // Preconditions: None
+    // Postconditions: Every newline written from now on is followed by width spaces, so that a cell spanning several
+    //                 lines stays in its column.
+    void setIndent(std::size_t width);
+
+    // Preconditions: None
+    // Postconditions: count spaces are appended without going through a stream.
+    void putSpaces(std::size_t count);
+
+    // Preconditions: None
+    // Postconditions: Pending text is written to the target.
+    void flushToTarget();
+
+protected:
+    int_type overflow(int_type c) override;
+    std::streamsize xsputn(const wchar_t* s, std::streamsize n) override;
+    // Flushing a stream over the buffer, e.g. through std::endl inside a cell, keeps the text pending: the table
+    // decides when to write.
+    int sync() override;
+
+private:
+    static constexpr std::size_t STAGING_SIZE = 256;
+
+    TextSink& target;
+    std::wstring pending;
+    std::size_t threshold;
+    std::size_t indent;
+    wchar_t staging[STAGING_SIZE];
+
+    void drainStaging();
+    void append(const wchar_t* s, std::size_t n);
+};
+
+#endif //PROJ1_LINEBUFFER_H
@@ -26,4 +26,63 @@ size_t displayLength(char)
     return 1;
 }
 
+size_t displayLength(wchar_t)
+{
+    return 1;
+}
+
+
+void MixedColumn::dumpNext(wostream& os)
+{
+    if (currentIndex == cells.size())
+        return;
+
+    if (!titlePrinted && !title.empty())
+    {
+        writeSpaces(os, leftPadding);
+        os << title;
+        writeSpaces(os, static_cast<int>(maxCharLength - title.size()) + rightPadding);
+        titlePrinted = true;
+        return;
+    }
+
+    writeSpaces(os, leftPadding);
+    renderCell(os, cells[currentIndex]);
+    currentIndex++;
+}
+
+void MixedColumn::writeSpaces(wostream& os, int n) const
+{
+    /// Explicit spaces instead of setw, see nSpace.
+    assert(n >= 0);
+    static const wstring spaces(256, L' ');
+    for (; n > 0; n -= static_cast<int>(spaces.size()))
+        os.write(spaces.data(), min(n, static_cast<int>(spaces.size())));
+}
+
+void MixedColumn::renderCell(wostream& os, const Cell& cell) const
+{
+    switch (cell.kind)
+    {
+        case CellKind::Number: writeNarrow(os, cell.digits, cell.width); break;
+        case CellKind::Character: os << cell.character; break;
+        case CellKind::NarrowText: os << cell.narrowText; break;
+        case CellKind::WideText: os << cell.wideText; break;
+        case CellKind::PooledText: os.write(textPool.data() + cell.range.first, cell.range.count); break;
+        case CellKind::IntegerList:
+            writeList(os, integerPool.cbegin() + cell.range.first,
+                      integerPool.cbegin() + cell.range.first + cell.range.count);
+            break;
+        case CellKind::FloatingList:
+            writeList(os, floatingPool.cbegin() + cell.range.first,
+                      floatingPool.cbegin() + cell.range.first + cell.range.count);
+            break;
+        case CellKind::NestedTable:
+            // A nested table pads itself.
+            tables[cell.range.first]->dumpTableTo(os);
+            return;
+        case CellKind::Custom: customCells[cell.range.first](os); break;
+    }
+    writeSpaces(os, static_cast<int>(maxCharLength - cell.width) + rightPadding);
+}
 
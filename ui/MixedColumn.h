@@ -13,7 +13,11 @@
 #include <iomanip>
 #include <functional>
 #include <cassert>
+#include <cstdint>
+#include <memory>
+#include <vector>
 #include "Table.h"
+#include "NumberFormat.h"
 #include "AbstractColumn.h"
 #include "configuration.h"
 
@@ -23,6 +27,7 @@ size_t displayLength(const char* cStr);
 size_t displayLength(const wchar_t* cStr);
 size_t displayLength(wstring WideStr);
 size_t displayLength(char);
+size_t displayLength(wchar_t);
 
 
 // Preconditions: A numerical type.
@@ -31,23 +36,44 @@ template<typename IntegerType,
         typename enable_if<is_integral<IntegerType>::value, int>::type = 0>
 size_t displayLength(const IntegerType& var)
 {
-    if (var < 0) return static_cast<size_t>(log10(-var) + 1 + 1);
-    else if (var == 0) return 1;
-    else return static_cast<size_t>(log10(var) + 1);
+    return NumberText(var).size();
 }
 
 
 // Preconditions: A floating type (float, double, ...).
-// Postconditions: The width it takes to display the value on screen.
+// Postconditions: The width it takes to display the value on screen with config::FLOAT_NUMBER_DIGITS decimals.
 template<typename FloatType,
          typename enable_if<is_floating_point<FloatType>::value, int>::type = 0>
 size_t displayLength(const FloatType& var)
 {
-    //if (long(var) == var)
-    //{
-    //    return displayLength(long(var));
-    //}
-    return displayLength((long)var) + config::FLOAT_NUMBER_DIGITS + 1;
+    return NumberText::fixed(static_cast<double>(var)).size();
+}
+
+
+// Preconditions: An element of a vector entry.
+// Postconditions: The width it takes on screen. Elements are printed without format flags, so floating ones take
+//                 the default stream format rather than the fixed one of a single floating entry.
+template <typename T>
+size_t elementLength(const T& element)
+{
+    if constexpr (is_floating_point_v<T>)
+        return NumberText::general(static_cast<double>(element)).size();
+    else
+        return displayLength(element);
+}
+
+
+// Preconditions: An element of a vector entry.
+// Postconditions: The element is written to os as elementLength measures it.
+template <typename T>
+void writeElement(wostream& os, const T& element)
+{
+    if constexpr (is_floating_point_v<T>)
+        NumberText::general(static_cast<double>(element)).writeTo(os);
+    else if constexpr (is_integral_v<T> && !is_same_v<T, char> && !is_same_v<T, wchar_t>)
+        NumberText(element).writeTo(os);
+    else
+        os << element;
 }
 
 
@@ -68,13 +94,17 @@ size_t displayLength(const vector<T>& vec)
             totalLength + string(", ...").size();
             return totalLength;
         }
-        totalLength += displayLength(*it) + string(", ").size();
+        totalLength += elementLength(*it) + string(", ").size();
     }
     totalLength -= string(", ").size();
     return totalLength;
 }
 
 
+// Cells are stored by value in one contiguous vector of small tagged records instead of one closure each; the
+// formatting is chosen by the tag when the column is dumped. Numbers live in the record, owned text and the values
+// of vector cells in per-column pools, and nested tables in their own list. Any other vector element type falls
+// back to a closure.
 class MixedColumn : public AbstractColumn
 {
 public:
@@ -86,7 +116,8 @@ public:
         rightPadding {_rightPadding},
         title {_title},
         maxCharLength {0},
-        titlePrinted {false}
+        titlePrinted {false},
+        currentIndex {0}
     {}
 
 
@@ -98,7 +129,8 @@ public:
         rightPadding {_rightPadding},
         title {_title},
         maxCharLength {0},
-        titlePrinted {false}
+        titlePrinted {false},
+        currentIndex {0}
     {
         addItems(items...);
     }
@@ -109,6 +141,7 @@ public:
     template <typename T>
     void repeatedAddItems(vector<T> _items)
     {
+        cells.reserve(cells.size() + _items.size());
         for (auto item: _items)
             addItems(item);
     }
@@ -125,7 +158,7 @@ public:
     template<>
     void addItems()
     {
-        currentIt = items.begin();
+        currentIndex = 0;
         maxCharLength = max(maxCharLength, title.size());
     }
     
@@ -136,12 +169,10 @@ public:
     void addItems(Table* table, OtherTypes... otherArgs)
     {
         maxCharLength = max(maxCharLength, static_cast<size_t>(table->tableWidth));
-        items.push_back(
-            [tablePtr = shared_ptr<Table>(table)] (wostream& os)
-            {
-                tablePtr->dumpTableTo(os);
-            }
-        );
+        Cell cell = makeCell(CellKind::NestedTable, 0);
+        cell.range = {tables.size(), 1};
+        tables.emplace_back(table);
+        cells.push_back(cell);
         addItems(otherArgs...);
     }
 
@@ -150,26 +181,19 @@ public:
     template <typename T, typename ...OtherType>
     void addItems(vector<T> vec, OtherType... otherArgs)
     {
-        maxCharLength = max(maxCharLength, displayLength(vec));
-        items.push_back(
-            [this, vec](wostream& os)
-            {
-                if (vec.empty())
-                    os << "None";
-                else
-                {
-                    for (auto it = vec.cbegin(); it != --vec.cend(); it++)
-                    {
-                        if (it != vec.cbegin()
-                            && distance(vec.cbegin(), it) % config::ARRAY_MAX_WRAPPING_LENGTH == 0)
-                            os << endl;
-                        os << *it << L", ";
-                    }
-                    os << vec.back();
-                }
-                os << nSpace(maxCharLength - displayLength(vec) + rightPadding);
-            }
-        );
+        size_t width = displayLength(vec);
+        maxCharLength = max(maxCharLength, width);
+        if constexpr (is_integral_v<T> && is_signed_v<T> && !isCharacter<T>)
+            cells.push_back(pooledValues(CellKind::IntegerList, integerPool, vec, width));
+        else if constexpr (is_floating_point_v<T>)
+            cells.push_back(pooledValues(CellKind::FloatingList, floatingPool, vec, width));
+        else
+        {
+            Cell cell = makeCell(CellKind::Custom, width);
+            cell.range = {customCells.size(), 1};
+            customCells.push_back([vec](wostream& os) { writeList(os, vec.cbegin(), vec.cend()); });
+            cells.push_back(cell);
+        }
         addItems(otherArgs...);
     }
 
@@ -178,19 +202,15 @@ public:
     template <typename T, typename ...OtherTypes>
     void addItems(optional<T> op, OtherTypes... otherArgs)
     {
-        if (op.has_value())
-            maxCharLength = max(maxCharLength, displayLength(op.value()));
+        if (!op.has_value())
+            addItems(L"None");
+        else if constexpr (is_floating_point_v<T>)
+        {
+            // Unlike a plain floating value, an optional one is printed in the default stream format.
+            addNumber(NumberText::general(static_cast<double>(op.value())));
+        }
         else
-            maxCharLength = max(maxCharLength, displayLength(L"None"));
-        items.push_back(
-            [this, op](wostream& os)
-            {
-                if (op.has_value())
-                    os << op.value() << nSpace(maxCharLength - displayLength(op.value()) + rightPadding);
-                else
-                    os << L"None" << nSpace(maxCharLength - displayLength(L"None") + rightPadding);
-            }
-        );
+            addItems(op.value());
         addItems(otherArgs...);
     }
     
@@ -200,13 +220,11 @@ public:
     template <typename ...OtherTypes>
     void addItems(const char* str, OtherTypes... otherArgs)
     {
-        maxCharLength = max(maxCharLength, displayLength(str));
-        items.push_back(
-            [this, str](wostream& os)
-            {
-                os << str << nSpace(maxCharLength - displayLength(str) + rightPadding);
-            }
-        );
+        size_t width = displayLength(str);
+        maxCharLength = max(maxCharLength, width);
+        Cell cell = makeCell(CellKind::NarrowText, width);
+        cell.narrowText = str;
+        cells.push_back(cell);
         addItems(otherArgs...);
     }
 
@@ -215,13 +233,11 @@ public:
     template <typename ...OtherTypes>
     void addItems(const wchar_t* str, OtherTypes... otherArgs)
     {
-        maxCharLength = max(maxCharLength, displayLength(str));
-        items.push_back(
-        [this, str](wostream& os)
-        {
-            os << str << nSpace(maxCharLength - displayLength(str) + rightPadding);
-        }
-        );
+        size_t width = displayLength(str);
+        maxCharLength = max(maxCharLength, width);
+        Cell cell = makeCell(CellKind::WideText, width);
+        cell.wideText = str;
+        cells.push_back(cell);
         addItems(otherArgs...);
     }
 
@@ -229,12 +245,12 @@ public:
     // Postconditions: cpp-wide-string is added as an entry in the column.
     template <typename ...OtherTypes>
     void addItems(wstring str, OtherTypes... otherArgs) {
-        maxCharLength = max(maxCharLength, displayLength(str));
-        items.push_back(
-        [this, str](wostream &os) {
-            os << str << nSpace(maxCharLength - displayLength(str) + rightPadding);
-        }
-        );
+        size_t width = displayLength(str);
+        maxCharLength = max(maxCharLength, width);
+        Cell cell = makeCell(CellKind::PooledText, width);
+        cell.range = {textPool.size(), str.size()};
+        textPool.append(str);
+        cells.push_back(cell);
         addItems(otherArgs...);
     }
 
@@ -245,13 +261,16 @@ public:
               typename ...OtherType>
     void addItems(IntegerType integer, OtherType... otherArgs)
     {
-        maxCharLength = max(maxCharLength, displayLength(integer));
-        items.push_back(
-            [this, integer](wostream& os)
-            {
-                os << integer << nSpace(maxCharLength - displayLength(integer) + rightPadding);
-            }
-        );
+        if constexpr (isCharacter<IntegerType>)
+        {
+            size_t width = displayLength(integer);
+            maxCharLength = max(maxCharLength, width);
+            Cell cell = makeCell(CellKind::Character, width);
+            cell.character = static_cast<wchar_t>(integer);
+            cells.push_back(cell);
+        }
+        else
+            addNumber(NumberText(integer));
         addItems(otherArgs...);
     }
 
@@ -262,15 +281,7 @@ public:
               typename ...OtherTypes>
     void addItems(FloatingType floatVar, OtherTypes... otherArgs)
     {
-        maxCharLength = max(maxCharLength, displayLength(floatVar));
-        items.push_back(
-            [this, floatVar](wostream& os)
-            {
-                os << fixed << setprecision(config::FLOAT_NUMBER_DIGITS)
-                    << floatVar
-                    << nSpace(maxCharLength - displayLength(floatVar) + rightPadding);
-            }
-        );
+        addNumber(NumberText::fixed(static_cast<double>(floatVar)));
         addItems(otherArgs...);
     }
     
@@ -289,25 +300,7 @@ public:
 
     // Preconditions: Expects an outputStream.
     // Postconditions: Dump the next entry in the column into outputStream given.
-    void dumpNext(wostream& os)
-    {
-        if (currentIt == items.cend())
-            return;
-
-        if (!titlePrinted && !title.empty())
-        {
-            os << nSpace(leftPadding)
-               << title
-               << nSpace(maxCharLength - title.size() + rightPadding);
-            titlePrinted = true;
-            return;
-        }
-        
-        os << nSpace(leftPadding);
-        invoke(*currentIt, os);
-
-        currentIt++;
-    }
+    void dumpNext(wostream& os);
     
 
     // Preconditions: Instance was properly initizalied.
@@ -321,7 +314,7 @@ public:
     // Postconditions: The number of entries is returned.
     const size_t getSize() override
     {
-        return items.size();
+        return cells.size();
     }
 
 
@@ -329,18 +322,108 @@ public:
     // Postconditions: Reset the column so that dumpNext starts printing from the beginning entry again.
     void reset() override
     {
-        currentIt = items.cbegin();
+        currentIndex = 0;
         titlePrinted = false;
     }
 
 private:
-    vector<function<void(wostream&)>> items;
+    enum class CellKind : uint8_t
+    {
+        Number, Character, NarrowText, WideText, PooledText, IntegerList, FloatingList, NestedTable, Custom
+    };
+
+    static constexpr size_t INLINE_DIGITS = 16;
+
+    // range indexes textPool, integerPool, floatingPool, tables or customCells depending on kind. A number keeps its
+    // formatted text in digits, width characters long, or in textPool when longer than INLINE_DIGITS.
+    struct Cell
+    {
+        CellKind kind;
+        uint32_t width;
+        union
+        {
+            char digits[INLINE_DIGITS];
+            wchar_t character;
+            const char* narrowText;
+            const wchar_t* wideText;
+            struct { size_t first, count; } range;
+        };
+    };
+
+    template <typename T>
+    static constexpr bool isCharacter = is_same_v<T, char> || is_same_v<T, wchar_t>;
+
+    vector<Cell> cells;
+    wstring textPool;
+    vector<long long> integerPool;
+    vector<double> floatingPool;
+    vector<shared_ptr<Table>> tables;
+    vector<function<void(wostream&)>> customCells;
     int leftPadding, rightPadding;
     size_t maxCharLength;
     wstring title;
     bool titlePrinted;
+    size_t currentIndex;
+
+    static Cell makeCell(CellKind kind, size_t width)
+    {
+        Cell cell;
+        cell.kind = kind;
+        cell.width = static_cast<uint32_t>(width);
+        cell.range = {0, 0};
+        return cell;
+    }
+
+    // Numbers are formatted once, when added: the width comes from the text that will be printed.
+    void addNumber(const NumberText& text)
+    {
+        maxCharLength = max(maxCharLength, text.size());
+        Cell cell;
+        if (text.size() <= INLINE_DIGITS)
+        {
+            cell = makeCell(CellKind::Number, text.size());
+            copy(text.data(), text.data() + text.size(), cell.digits);
+        }
+        else
+        {
+            cell = makeCell(CellKind::PooledText, text.size());
+            cell.range = {textPool.size(), text.size()};
+            textPool.append(text.data(), text.data() + text.size());
+        }
+        cells.push_back(cell);
+    }
+
+    template <typename Pooled, typename T>
+    static Cell pooledValues(CellKind kind, vector<Pooled>& pool, const vector<T>& vec, size_t width)
+    {
+        Cell cell = makeCell(kind, width);
+        cell.range = {pool.size(), vec.size()};
+        pool.insert(pool.end(), vec.cbegin(), vec.cend());
+        return cell;
+    }
+
+    // The layout of a vector cell: values separated by ", ", wrapped every ARRAY_MAX_WRAPPING_LENGTH values except
+    // before the last one, "None" when empty.
+    template <typename Iterator>
+    static void writeList(wostream& os, Iterator first, Iterator last)
+    {
+        if (first == last)
+        {
+            os << "None";
+            return;
+        }
+        for (auto it = first; it != last - 1; it++)
+        {
+            if (it != first && distance(first, it) % config::ARRAY_MAX_WRAPPING_LENGTH == 0)
+                os << endl;
+            writeElement(os, *it);
+            os << L", ";
+        }
+        writeElement(os, *(last - 1));
+    }
 
-    decltype(items.cbegin()) currentIt;
+    void writeSpaces(wostream& os, int n) const;
+    void renderCell(wostream& os, const Cell& cell) const;
 };
 
 
@@ -0,0 +1,41 @@
+// Name : Long Duong
+// Date: 10/17/2026
+// Description: Implements the floating point formats of NumberText.
+
+#include "NumberFormat.h"
+
+NumberText NumberText::fixed(double value, int digits)
+{
+    NumberText text;
+    auto result = std::to_chars(text.buffer, text.buffer + BUFFER_SIZE, value, std::chars_format::fixed, digits);
+    text.length = static_cast<std::size_t>(result.ptr - text.buffer);
+    return text;
+}
+
+NumberText NumberText::general(double value)
+{
+    // 6 is the default precision of every stream.
+    NumberText text;
+    auto result = std::to_chars(text.buffer, text.buffer + BUFFER_SIZE, value, std::chars_format::general, 6);
+    text.length = static_cast<std::size_t>(result.ptr - text.buffer);
+    return text;
+}
+
+void NumberText::writeTo(std::wostream& os) const
+{
+    writeNarrow(os, buffer, length);
+}
+
+void writeNarrow(std::wostream& os, const char* text, std::size_t n)
+{
+    wchar_t wide[64];
+    while (n > 0)
+    {
+        std::size_t chunk = n < 64 ? n : 64;
+        for (std::size_t i = 0; i < chunk; i++)
+            wide[i] = static_cast<wchar_t>(text[i]);
+        os.write(wide, static_cast<std::streamsize>(chunk));
+        text += chunk;
+        n -= chunk;
+    }
+}
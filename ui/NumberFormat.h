@@ -0,0 +1,74 @@
+// Name : Long Duong
+// Date: 10/17/2026
+// Description: The text of numbers shown in tables, produced by to_chars so that a value is formatted once and its
+//              display width is the length of exactly the text that is printed.
+
+#ifndef PROJ1_NUMBERFORMAT_H
+#define PROJ1_NUMBERFORMAT_H
+
+#include <iostream>
+#include <charconv>
+#include <limits>
+#include <type_traits>
+#include "configuration.h"
+
+// Formats into a buffer on the stack and never touches stream state, unlike fixed and setprecision which stay set on
+// the stream for every later cell.
+class NumberText
+{
+public:
+    // Preconditions: None
+    // Postconditions: Instance holds the decimal digits of value.
+    template <typename Integer, typename std::enable_if<std::is_integral<Integer>::value, int>::type = 0>
+    explicit NumberText(Integer value)
+    {
+        // to_chars takes no bool, which a stream prints as 0 or 1.
+        using Printed = typename std::conditional<std::is_same<Integer, bool>::value, int, Integer>::type;
+        length = static_cast<std::size_t>(
+            std::to_chars(buffer, buffer + BUFFER_SIZE, static_cast<Printed>(value)).ptr - buffer);
+    }
+
+    // Preconditions: 0 <= digits <= config::FLOAT_NUMBER_DIGITS
+    // Postconditions: Return value with digits decimals, as fixed << setprecision(digits) prints it.
+    static NumberText fixed(double value, int digits = config::FLOAT_NUMBER_DIGITS);
+
+    // Preconditions: None
+    // Postconditions: Return value as a stream prints it without any format flags, %g with 6 significant digits.
+    static NumberText general(double value);
+
+    // Preconditions: None
+    // Postconditions: Return the formatted characters, not null terminated.
+    const char* data() const
+    {
+        return buffer;
+    }
+
+    // Preconditions: None
+    // Postconditions: Return the number of characters, which is also the display width.
+    std::size_t size() const
+    {
+        return length;
+    }
+
+    // Preconditions: None
+    // Postconditions: The text is written to os.
+    void writeTo(std::wostream& os) const;
+
+private:
+    // Room for the longest fixed double: every integer digit of the largest double, a sign, a point and the decimals.
+    static constexpr std::size_t BUFFER_SIZE =
+        std::numeric_limits<double>::max_exponent10 + 4 + config::FLOAT_NUMBER_DIGITS;
+
+    char buffer[BUFFER_SIZE];
+    std::size_t length;
+
+    NumberText() :
+        length {0}
+    {}
+};
+
+// Preconditions: text points to n ASCII characters.
+// Postconditions: The characters are widened and written to os in one call.
+void writeNarrow(std::wostream& os, const char* text, std::size_t n);
+
+#endif //PROJ1_NUMBERFORMAT_H
@@ -0,0 +1,155 @@
+// Name : Long Duong
+// Date: 10/17/2026
+// Description: A column that renders a whole dataset as one wrapped cell straight from a view of the values.
+
+#ifndef PROJ1_SPANCOLUMN_H
+#define PROJ1_SPANCOLUMN_H
+
+#include <iostream>
+#include <string>
+#include <span>
+#include <algorithm>
+#include "AbstractColumn.h"
+#include "MixedColumn.h"
+#include "configuration.h"
+
+using namespace std;
+
+// Renders exactly like MixedColumn::addItems(vector) does: config::ARRAY_MAX_WRAPPING_LENGTH values per line, the
+// width taken from the first values only. Nothing is copied; the values are read from the view when the table is
+// dumped, so the view must stay valid until then. Long data can be cut to its first headLines and last tailLines
+// lines around a "..." line, which keeps rendering constant in time as well. Values is a span or any view with
+// size(), empty() and operator[] returning the values in order, such as Statistics::ElementView.
+template <typename T, typename Values = span<const T>>
+class SpanColumn : public AbstractColumn
+{
+public:
+    // Preconditions: values stays valid while the column is dumped.
+    // Postconditions: Instance holds one entry showing values, truncated if it needs more than
+    //                 headLines + tailLines lines and that sum is not 0.
+    SpanColumn(int _leftPadding, int _rightPadding, wstring&& _title, Values _values,
+               size_t _headLines = 0, size_t _tailLines = 0) :
+        values {_values},
+        leftPadding {_leftPadding},
+        rightPadding {_rightPadding},
+        title {_title},
+        headLines {_headLines},
+        tailLines {_tailLines},
+        valueLength {measureValues()},
+        maxCharLength {max(valueLength, title.size())},
+        titlePrinted {false},
+        valuePrinted {false}
+    {}
+
+    ~SpanColumn() override = default;
+
+    // Preconditions: Instance was properly initialized.
+    // Postconditions: The width of the column with padding is returned.
+    const int getColumnWidth() const override
+    {
+        return leftPadding + static_cast<int>(maxCharLength) + rightPadding;
+    }
+
+    // Preconditions: Instance was properly initialized.
+    // Postconditions: The number of entries is returned, the values being a single entry.
+    const size_t getSize() override
+    {
+        return 1;
+    }
+
+    // Preconditions: Expects an outputStream.
+    // Postconditions: The title, then the values, are dumped into the stream on successive calls.
+    void dumpNext(wostream& os) override
+    {
+        if (valuePrinted)
+            return;
+        if (!titlePrinted && !title.empty())
+        {
+            os << wstring(leftPadding, L' ') << title << wstring(maxCharLength - title.size() + rightPadding, L' ');
+            titlePrinted = true;
+            return;
+        }
+
+        os << wstring(leftPadding, L' ');
+        if (values.empty())
+            os << "None";
+        else
+        {
+            const size_t perLine = config::ARRAY_MAX_WRAPPING_LENGTH;
+            size_t lineCount = (values.size() + perLine - 1) / perLine;
+            bool truncated = headLines + tailLines > 0 && lineCount > headLines + tailLines;
+            if (!truncated)
+                writeValues(os, 0, values.size());
+            else
+            {
+                writeValues(os, 0, headLines * perLine);
+                if (headLines > 0)
+                    os << endl;
+                os << L"...";
+                if (tailLines > 0)
+                {
+                    os << endl;
+                    writeValues(os, (lineCount - tailLines) * perLine, values.size());
+                }
+            }
+        }
+        os << wstring(maxCharLength - valueLength + rightPadding, L' ');
+        valuePrinted = true;
+    }
+
+    // Preconditions: None
+    // Postconditions: The next dumps are truncated to headLines and tailLines as in the constructor; 0 and 0 show
+    //                 every value. The width does not depend on the truncation.
+    void setTruncation(size_t _headLines, size_t _tailLines)
+    {
+        headLines = _headLines;
+        tailLines = _tailLines;
+    }
+
+    // Preconditions: Instance was properly constructed.
+    // Postconditions: dumpNext starts from the title again.
+    void reset() override
+    {
+        titlePrinted = false;
+        valuePrinted = false;
+    }
+
+private:
+    Values values;
+    int leftPadding, rightPadding;
+    wstring title;
+    size_t headLines, tailLines;
+    size_t valueLength;
+    size_t maxCharLength;
+    bool titlePrinted;
+    bool valuePrinted;
+
+    // Same rule as displayLength(vector): the first ARRAY_MAX_WRAPPING_LENGTH + 1 values with their separators.
+    size_t measureValues() const
+    {
+        if (values.empty())
+            return displayLength("None");
+        size_t measured = min(values.size(), static_cast<size_t>(config::ARRAY_MAX_WRAPPING_LENGTH) + 1);
+        size_t length = 0;
+        for (size_t i = 0; i < measured; i++)
+            length += elementLength(values[i]) + string(", ").size();
+        return measured == values.size() ? length - string(", ").size() : length;
+    }
+
+    // Values [first, last) separated by ", ", a line break before every multiple of the wrapping length except
+    // first and, as in MixedColumn, the very last value. A range that stops before the end keeps its trailing
+    // separator, like a wrapped line does.
+    void writeValues(wostream& os, size_t first, size_t last) const
+    {
+        for (size_t i = first; i < last; i++)
+        {
+            if (i != first && i + 1 != values.size() && i % config::ARRAY_MAX_WRAPPING_LENGTH == 0)
+                os << endl;
+            writeElement(os, values[i]);
+            if (i + 1 != values.size())
+                os << L", ";
+        }
+    }
+};
+
+#endif //PROJ1_SPANCOLUMN_H
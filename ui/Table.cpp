@@ -64,49 +64,48 @@ std::wstring Table::singleLine(int n)
 
 void Table::dumpTableTo(std::wostream& os) const
 {
+    WideStreamSink sink(os);
+    dumpTableTo(sink);
+}
+
+void Table::dumpTableTo(TextSink& sink) const
+{
+    // Every row is rendered into one reusable buffer instead of a string stream per cell, and the column offsets
+    // used to indent the continuation lines of a cell are computed once.
+    LineBuffer buffer(sink);
+    std::wostream line(&buffer);
+
     if (!title.empty())
     {
-        os << nSpace(leftPadding)
-           << title
-           << std::endl;
+        buffer.putSpaces(leftPadding);
+        line << title << L'\n';
+        buffer.putSpaces(leftPadding);
+        line << doubleLine(consoleWidth - leftPadding - rightPadding) << L'\n';
+    }
 
-        os << nSpace(leftPadding)
-           << doubleLine(consoleWidth - leftPadding - rightPadding)
-           << std::endl;
+    std::vector<std::size_t> columnOffsets;
+    std::size_t offset = leftPadding;
+    for (const auto* column : columns)
+    {
+        columnOffsets.push_back(offset);
+        offset += column->getColumnWidth();
     }
 
     for (std::size_t i = 0; i <= columns.at(0)->getSize(); i++)
     {
-        os << nSpace(leftPadding);
-        for (auto columnIt = columns.begin(); columnIt != columns.end(); columnIt++)
+        buffer.putSpaces(leftPadding);
+        for (std::size_t c = 0; c < columns.size(); c++)
         {
-            auto& column = *columnIt;
-            std::wstringstream tmpOs;
-            column->dumpNext(tmpOs);
-            wchar_t t ;
-            while (tmpOs.get(t))
-            {
-                if (t != '\n')
-                {
-                    os << t;
-                }
-                else
-                {
-                    auto previousColumnsWidth =
-                    std::transform_reduce(
-                    columns.begin(), columnIt,
-                    leftPadding,
-                    std::plus<>(),
-                    [](const auto& col){ return col->getColumnWidth();}
-                    );
-                    os << t
-                       << nSpace(previousColumnsWidth);
-                }
-            }
+            buffer.setIndent(columnOffsets[c]);
+            columns[c]->dumpNext(line);
         }
-        os << std::endl;
+        buffer.setIndent(0);
+        line << L'\n';
     }
 
+    buffer.flushToTarget();
+    sink.flush();
+
     for (auto* column : columns)
         column->reset();
 }
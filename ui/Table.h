@@ -10,9 +10,9 @@
 #include <algorithm>
 #include <vector>
 #include <type_traits>
-#include <sstream>
 #include "configuration.h"
 #include "AbstractColumn.h"
+#include "LineBuffer.h"
 
 class Table 
 {
@@ -42,6 +42,10 @@ public:
     // Preconditions: Table was properly initialized with columns
     // Postconditions: Content of columns contained is dumped into outstream.
     void dumpTableTo(std::wostream& os) const;
+
+    // Preconditions: Table was properly initialized with columns
+    // Postconditions: Content of columns contained is written to sink, which is flushed.
+    void dumpTableTo(TextSink& sink) const;
     
     // Preconditions: Table was properly initialized with heap allocated columns
     // Postconditions: All columns object contained is deallocated.
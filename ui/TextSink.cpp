@@ -0,0 +1,206 @@
+// Name : Long Duong
+// Date: 10/17/2026
+// Description: Implements the wide stream and UTF-8 file descriptor sinks.
+
+#include <cstdio>
+#include "TextSink.h"
+
+#ifdef _WIN32
+#include <io.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+    const int STANDARD_OUTPUT = 1;
+
+    int openForWriting(const std::string& path)
+    {
+#ifdef _WIN32
+        return _open(path.c_str(), _O_WRONLY | _O_CREAT | _O_TRUNC | _O_BINARY, _S_IREAD | _S_IWRITE);
+#else
+        return ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0666);
+#endif
+    }
+
+    // Appends the UTF-8 bytes of code point c.
+    void appendUtf8(std::string& out, char32_t c)
+    {
+        if (c < 0x80)
+            out.push_back(static_cast<char>(c));
+        else if (c < 0x800)
+        {
+            out.push_back(static_cast<char>(0xC0 | c >> 6));
+            out.push_back(static_cast<char>(0x80 | (c & 0x3F)));
+        }
+        else if (c < 0x10000)
+        {
+            out.push_back(static_cast<char>(0xE0 | c >> 12));
+            out.push_back(static_cast<char>(0x80 | (c >> 6 & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | (c & 0x3F)));
+        }
+        else
+        {
+            out.push_back(static_cast<char>(0xF0 | c >> 18));
+            out.push_back(static_cast<char>(0x80 | (c >> 12 & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | (c >> 6 & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | (c & 0x3F)));
+        }
+    }
+
+    bool isHighSurrogate(char32_t c) { return c >= 0xD800 && c <= 0xDBFF; }
+    bool isLowSurrogate(char32_t c) { return c >= 0xDC00 && c <= 0xDFFF; }
+    bool isSurrogate(char32_t c) { return c >= 0xD800 && c <= 0xDFFF; }
+
+    // What cannot be encoded, an unpaired surrogate or a value past U+10FFFF, becomes U+FFFD.
+    const char32_t REPLACEMENT_CHARACTER = 0xFFFD;
+}
+
+WideStreamSink::WideStreamSink(std::wostream& _target) :
+    target {_target}
+{}
+
+void WideStreamSink::write(const wchar_t* s, std::size_t n)
+{
+    target.write(s, static_cast<std::streamsize>(n));
+}
+
+void WideStreamSink::flush()
+{
+    target.flush();
+}
+
+Utf8FileSink::Utf8FileSink(int _fd) :
+    fd {_fd},
+    ownsFile {false},
+    pendingSurrogate {0}
+{
+    encoded.reserve(FLUSH_THRESHOLD + 4 * 256);
+}
+
+Utf8FileSink::Utf8FileSink(const std::string& path) :
+    fd {openForWriting(path)},
+    ownsFile {true},
+    pendingSurrogate {0}
+{
+    encoded.reserve(FLUSH_THRESHOLD + 4 * 256);
+}
+
+Utf8FileSink::~Utf8FileSink()
+{
+    flush();
+    if (ownsFile && fd >= 0)
+    {
+#ifdef _WIN32
+        _close(fd);
+#else
+        ::close(fd);
+#endif
+    }
+}
+
+bool Utf8FileSink::isOpen() const
+{
+    return fd >= 0;
+}
+
+void Utf8FileSink::write(const wchar_t* s, std::size_t n)
+{
+    const wchar_t* end = s + n;
+    while (s != end)
+    {
+        // Table text is almost all ASCII: copy runs of it without looking at them twice.
+        const wchar_t* ascii = s;
+        while (ascii != end && static_cast<char32_t>(*ascii) < 0x80 && pendingSurrogate == 0)
+            ascii++;
+        if (ascii != s)
+        {
+            std::size_t first = encoded.size();
+            encoded.resize(first + static_cast<std::size_t>(ascii - s));
+            for (char* out = encoded.data() + first; s != ascii; s++, out++)
+                *out = static_cast<char>(*s);
+        }
+        else
+        {
+            char32_t c = static_cast<char32_t>(*s++);
+            if (pendingSurrogate != 0)
+            {
+                char32_t high = static_cast<char32_t>(pendingSurrogate);
+                pendingSurrogate = 0;
+                if (isLowSurrogate(c))
+                {
+                    appendUtf8(encoded, 0x10000 + ((high - 0xD800) << 10) + (c - 0xDC00));
+                    continue;
+                }
+                appendUtf8(encoded, REPLACEMENT_CHARACTER);
+            }
+            if (sizeof(wchar_t) == 2 && isHighSurrogate(c))
+                pendingSurrogate = static_cast<wchar_t>(c);
+            else
+                appendUtf8(encoded, isSurrogate(c) || c > 0x10FFFF ? REPLACEMENT_CHARACTER : c);
+        }
+        if (encoded.size() >= FLUSH_THRESHOLD)
+        {
+            writeBytes(encoded.data(), encoded.size());
+            encoded.clear();
+        }
+    }
+}
+
+void Utf8FileSink::flush()
+{
+    // A high surrogate still waiting for its pair at a flush is unpaired: write it as U+FFFD like any other.
+    if (pendingSurrogate != 0)
+    {
+        pendingSurrogate = 0;
+        appendUtf8(encoded, REPLACEMENT_CHARACTER);
+    }
+    if (encoded.empty())
+        return;
+    writeBytes(encoded.data(), encoded.size());
+    encoded.clear();
+}
+
+void Utf8FileSink::writeBytes(const char* bytes, std::size_t n)
+{
+    if (fd < 0)
+        return;
+    if (fd == STANDARD_OUTPUT)
+    {
+        std::wcout.flush();
+        std::fflush(stdout);
+    }
+    while (n > 0)
+    {
+#ifdef _WIN32
+        int written = _write(fd, bytes, static_cast<unsigned>(n < (1u << 30) ? n : (1u << 30)));
+        if (written < 0)
+            return;
+#else
+        ssize_t written = ::write(fd, bytes, n);
+        if (written < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            return;
+        }
+#endif
+        bytes += written;
+        n -= static_cast<std::size_t>(written);
+    }
+}
+
+TextSink& consoleSink()
+{
+#ifdef _WIN32
+    static WideStreamSink console(std::wcout);
+#else
+    static Utf8FileSink console(STANDARD_OUTPUT);
+#endif
+    return console;
+}
@@ -0,0 +1,88 @@
+// Name : Long Duong
+// Date: 10/17/2026
+// Description: Destinations for rendered table text: a wide stream, or UTF-8 written straight to a file descriptor.
+
+#ifndef PROJ1_TEXTSINK_H
+#define PROJ1_TEXTSINK_H
+
+#include <iostream>
+#include <string>
+
+class TextSink
+{
+public:
+    virtual ~TextSink() = default;
+
+    // Preconditions: s points to n characters.
+    // Postconditions: The characters are handed to the destination, possibly buffered.
+    virtual void write(const wchar_t* s, std::size_t n) = 0;
+
+    // Preconditions: None
+    // Postconditions: Everything written so far has reached the destination.
+    virtual void flush() = 0;
+};
+
+// Converts through the locale of the stream, one character at a time for a file stream.
+class WideStreamSink : public TextSink
+{
+public:
+    // Preconditions: target outlives the instance.
+    // Postconditions: Text is written to target.
+    explicit WideStreamSink(std::wostream& target);
+
+    void write(const wchar_t* s, std::size_t n) override;
+    void flush() override;
+
+private:
+    std::wostream& target;
+};
+
+// Encodes whole blocks of text to UTF-8 and writes the bytes to a file descriptor, bypassing streams and locales.
+class Utf8FileSink : public TextSink
+{
+public:
+    // Preconditions: fd is open for writing and outlives the instance. If it is standard output, wcout should not
+    //                be used at the same time on another thread.
+    // Postconditions: Text is written to fd, which is not closed by the instance. For standard output, whatever
+    //                 wcout and stdout hold is flushed before each write so the output stays in order.
+    explicit Utf8FileSink(int fd);
+
+    // Preconditions: None
+    // Postconditions: The file is created or truncated; isOpen tells whether that succeeded.
+    explicit Utf8FileSink(const std::string& path);
+
+    Utf8FileSink(const Utf8FileSink&) = delete;
+    Utf8FileSink& operator=(const Utf8FileSink&) = delete;
+
+    // Preconditions: None
+    // Postconditions: Pending bytes are written and a file opened by the instance is closed.
+    ~Utf8FileSink() override;
+
+    // Preconditions: None
+    // Postconditions: Return whether the instance has a file to write to.
+    bool isOpen() const;
+
+    void write(const wchar_t* s, std::size_t n) override;
+
+    // Preconditions: None
+    // Postconditions: Pending bytes are written. A high surrogate left without its pair is written as U+FFFD.
+    void flush() override;
+
+private:
+    static constexpr std::size_t FLUSH_THRESHOLD = 1 << 16;
+
+    int fd;
+    bool ownsFile;
+    std::string encoded;
+    // A high surrogate whose pair has not been written yet, where wchar_t is UTF-16.
+    wchar_t pendingSurrogate;
+
+    void writeBytes(const char* bytes, std::size_t n);
+};
+
+// Preconditions: None
+// Postconditions: Return the sink tables are shown through on the console: UTF-8 on standard output on POSIX, wcout
+//                 on Windows where the console expects wide characters.
+TextSink& consoleSink();
+
+#endif //PROJ1_TEXTSINK_H
@@ -12,6 +12,34 @@ namespace config {
 
     const int DEFAULT_LEFT_PADDING = 0;
     const int DEFAULT_RIGHT_PADDING = 5;
+
+    // Data echoed by the statistics UI shows at most this many wrapped lines from its start and from its end.
+    const int DATA_HEAD_LINES = 50;
+    const int DATA_TAIL_LINES = 10;
+
+    // Number of worker threads used by the parallel statistics paths, 0 means one per hardware thread.
+    const int WORKER_THREAD_COUNT = 0;
+    // Reductions are split into blocks of this many elements. When deterministic, the block layout does not depend
+    // on the thread count so results are bit-identical on every machine.
+    const int REDUCTION_BLOCK_SIZE = 1 << 16;
+    const bool DETERMINISTIC_REDUCTIONS = true;
+
+    // Memory bounds of StreamingStatistics: the KLL accuracy parameter (rank error about 1.3% at 200), the number
+    // of distinct values counted for the mode and frequency table, and how many of the smallest and largest values
+    // are kept to list outliers.
+    const int QUANTILE_SKETCH_K = 200;
+    const int FREQUENCY_SKETCH_CAPACITY = 1024;
+    const int STREAMING_EXTREME_CAPACITY = 1024;
+
+    // Memory budget of ExternalStatistics in MiB: sorted runs, merge buffers and the frequency table stay within it.
+    const int EXTERNAL_MEMORY_BUDGET_MB = 256;
+
+    // Statistics::StorageMode::Auto keeps only (value, count) runs when distinct values / size is at most this.
+    const double RUN_LENGTH_DISTINCT_RATIO = 0.01;
+
+    // DynamicStatistics rebuilds its moments from the tree once the squared deviations removed by erase exceed this
+    // multiple of the remaining ones.
+    const double MOMENT_DRIFT_RATIO = 1e6;
 }
 
 #endif //PROJ1_CONFIGURATION_H